@@ -0,0 +1,73 @@
+#include "Game/AutoplayBot.hpp"
+
+#include "Game/GameCommon.hpp"
+#include "Game/InterceptSolver.hpp"
+
+#include <algorithm>
+
+void AutoplayBot::Reset() noexcept {
+    m_pending.clear();
+    m_nextShotTime = TimeUtils::FPSeconds::zero();
+    m_stats = Stats{};
+}
+
+std::optional<AutoplayBot::Shot> AutoplayBot::Update(const InterceptSolver& solver, std::size_t waveId, TimeUtils::FPSeconds deltaSeconds) noexcept {
+    m_stats.playTime += deltaSeconds;
+    ++m_stats.frames;
+    ++m_stats.intervalFrames;
+    m_stats.intervalFrameTime += deltaSeconds;
+    m_stats.maxFrameTime = (std::max)(m_stats.maxFrameTime, deltaSeconds);
+    if (waveId != m_stats.waveId) {
+        m_stats.waveId = waveId;
+        m_stats.waveStartTime = m_stats.playTime;
+    }
+
+    const auto now = m_stats.playTime;
+    std::erase_if(m_pending, [now](const PendingShot& shot) { return shot.expires <= now; });
+    if (now < m_nextShotTime) {
+        return std::nullopt;
+    }
+    auto best = std::optional<std::size_t>{};
+    auto best_impact = TimeUtils::FPSeconds{};
+    for (std::size_t i = 0u; i < solver.GetThreatCount(); ++i) {
+        if (solver.GetIntercept(i).launcher == InterceptSolver::no_launcher) {
+            continue;
+        }
+        const auto impact = solver.GetTimeToImpact(i);
+        if (best.has_value() && best_impact <= impact) {
+            continue;
+        }
+        if (!IsCovered(solver.GetIntercept(i).aim)) {
+            best = i;
+            best_impact = impact;
+        }
+    }
+    if (!best.has_value()) {
+        return std::nullopt;
+    }
+    const auto intercept = solver.GetIntercept(*best);
+    //If the catch fails the threat is uncovered again shortly after, and gets another shot.
+    m_pending.push_back(PendingShot{ intercept.aim, now + intercept.time + TimeUtils::FPSeconds{ GameConstants::autoplay_retry_seconds } });
+    m_nextShotTime = now + TimeUtils::FPSeconds{ GameConstants::autoplay_fire_interval_seconds };
+    ++m_stats.shots;
+    return Shot{ static_cast<std::size_t>(intercept.launcher), intercept.aim };
+}
+
+const AutoplayBot::Stats& AutoplayBot::GetStats() const noexcept {
+    return m_stats;
+}
+
+void AutoplayBot::ResetFrameTimes() noexcept {
+    m_stats.intervalFrames = 0u;
+    m_stats.intervalFrameTime = TimeUtils::FPSeconds::zero();
+    m_stats.maxFrameTime = TimeUtils::FPSeconds::zero();
+}
+
+bool AutoplayBot::IsWaveStalled() const noexcept {
+    return TimeUtils::FPSeconds{ GameConstants::autoplay_stall_seconds } < m_stats.playTime - m_stats.waveStartTime;
+}
+
+bool AutoplayBot::IsCovered(Vector2 aim) const noexcept {
+    constexpr const auto cover_radius_squared = GameConstants::autoplay_cover_radius * GameConstants::autoplay_cover_radius;
+    return std::any_of(m_pending.begin(), m_pending.end(), [aim](const PendingShot& shot) { return (shot.aim - aim).CalcLengthSquared() < cover_radius_squared; });
+}
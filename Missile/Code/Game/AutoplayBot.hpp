@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+class InterceptSolver;
+
+//Defends the cities unattended so long soak runs can play through many waves.
+//Each shot goes at the uncovered enemy missile closest to impact, from the base the intercept solver picked.
+//A missile counts as covered while an earlier shot is still due to catch it, so one threat does not draw every base's fire.
+//Also keeps the frame and wave figures the soak report is built from.
+class AutoplayBot {
+public:
+    struct Shot {
+        std::size_t launcher{0u};
+        Vector2 target{};
+    };
+    struct Stats {
+        TimeUtils::FPSeconds playTime{};
+        std::uint64_t frames{0u};
+        std::uint64_t shots{0u};
+        //Since the last ResetFrameTimes.
+        std::uint64_t intervalFrames{0u};
+        TimeUtils::FPSeconds intervalFrameTime{};
+        TimeUtils::FPSeconds maxFrameTime{};
+        std::size_t waveId{0u};
+        TimeUtils::FPSeconds waveStartTime{};
+    };
+
+    AutoplayBot() = default;
+    AutoplayBot(const AutoplayBot& other) = default;
+    AutoplayBot(AutoplayBot&& other) = default;
+    AutoplayBot& operator=(const AutoplayBot& other) = default;
+    AutoplayBot& operator=(AutoplayBot&& other) = default;
+    ~AutoplayBot() = default;
+
+    void Reset() noexcept;
+
+    //Call once per frame with a fresh solve. Returns the shot to fire this frame, if any.
+    std::optional<Shot> Update(const InterceptSolver& solver, std::size_t waveId, TimeUtils::FPSeconds deltaSeconds) noexcept;
+
+    const Stats& GetStats() const noexcept;
+    void ResetFrameTimes() noexcept;
+    //True once the current wave has gone on longer than any wave should.
+    bool IsWaveStalled() const noexcept;
+
+protected:
+private:
+    struct PendingShot {
+        Vector2 aim{};
+        TimeUtils::FPSeconds expires{};
+    };
+
+    bool IsCovered(Vector2 aim) const noexcept;
+
+    std::vector<PendingShot> m_pending{};
+    TimeUtils::FPSeconds m_nextShotTime{};
+    Stats m_stats{};
+};
@@ -0,0 +1,69 @@
+#include "Game/CircleLod.hpp"
+
+#include "Game/GameCommon.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace {
+    //Largest radius in pixels each level draws within the error budget. The chord of a segment of angle a sits
+    //r(1 - cos(a/2)) inside the circle, and 1 - cos(x) <= x^2 / 2 keeps this bound conservative.
+    constexpr const std::array<float, CircleLod::segment_counts.size()> level_max_pixel_radius = []() {
+        auto radii = std::array<float, CircleLod::segment_counts.size()>{};
+        constexpr const float pi{std::numbers::pi_v<float>};
+        for (std::size_t i = 0u; i < radii.size(); ++i) {
+            const auto n = static_cast<float>(CircleLod::segment_counts[i]);
+            radii[i] = 2.0f * GameConstants::circle_lod_max_error_pixels * n * n / (pi * pi);
+        }
+        return radii;
+    }();
+
+    const std::array<std::vector<Vector2>, CircleLod::segment_counts.size()> unit_circles = []() {
+        auto circles = std::array<std::vector<Vector2>, CircleLod::segment_counts.size()>{};
+        for (std::size_t i = 0u; i < circles.size(); ++i) {
+            const auto n = CircleLod::segment_counts[i];
+            circles[i].reserve(n);
+            for (std::size_t k = 0u; k < n; ++k) {
+                const auto theta = 2.0f * std::numbers::pi_v<float> * static_cast<float>(k) / static_cast<float>(n);
+                circles[i].push_back(Vector2{ std::cos(theta), std::sin(theta) });
+            }
+        }
+        return circles;
+    }();
+}
+
+namespace CircleLod {
+    std::size_t SelectLevel(float pixelRadius) noexcept {
+        for (std::size_t i = 0u; i < level_max_pixel_radius.size(); ++i) {
+            if (pixelRadius <= level_max_pixel_radius[i]) {
+                return i;
+            }
+        }
+        return level_max_pixel_radius.size() - 1u;
+    }
+
+    std::span<const Vector2> GetUnitCircle(std::size_t level) noexcept {
+        return unit_circles[level];
+    }
+
+    std::size_t AppendFilledCircle(Mesh::Builder& builder, Vector2 center, float radius, float pixelsPerUnit, const Rgba& color) noexcept {
+        const auto ring = GetUnitCircle(SelectLevel(radius * pixelsPerUnit));
+        const auto center_index = static_cast<unsigned int>(builder.verticies.size());
+        const auto segments = static_cast<unsigned int>(ring.size());
+        builder.SetColor(color);
+        builder.AddVertex(center);
+        for (const auto& direction : ring) {
+            builder.AddVertex(center + direction * radius);
+        }
+        //Same winding as center, previous, current around the ring.
+        auto previous = segments - 1u;
+        for (unsigned int current = 0u; current < segments; ++current) {
+            builder.indicies.push_back(center_index);
+            builder.indicies.push_back(center_index + 1u + previous);
+            builder.indicies.push_back(center_index + 1u + current);
+            previous = current;
+        }
+        return ring.size();
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+
+#include "Engine/Renderer/Mesh.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+//Filled circles tessellated with just enough segments for their on-screen size.
+namespace CircleLod {
+    //Segment counts per level, coarsest first.
+    constexpr const std::array<std::size_t, 7> segment_counts{ 8u, 12u, 16u, 24u, 32u, 48u, 64u };
+
+    //Index into segment_counts for a circle of the given radius in pixels.
+    std::size_t SelectLevel(float pixelRadius) noexcept;
+    //segment_counts[level] points on the unit circle, counter-clockwise from +x.
+    std::span<const Vector2> GetUnitCircle(std::size_t level) noexcept;
+    //Appends an indexed triangle fan to the open Triangles range in builder and returns the segment count used.
+    //The center and each ring point are written once, so a circle of n segments costs n + 1 vertices and 3n indices.
+    std::size_t AppendFilledCircle(Mesh::Builder& builder, Vector2 center, float radius, float pixelsPerUnit, const Rgba& color) noexcept;
+}
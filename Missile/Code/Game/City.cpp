@@ -8,11 +8,19 @@
 #include "Engine/Renderer/Renderer.hpp"
 
 #include "Game/Game.hpp"
+#include "Game/RenderSnapshot.hpp"
 
 #include <utility>
 
-City::City(Vector2 position) noexcept
-    : m_position{position}
+City::City(GameStateMain* world) noexcept
+    : City{world, Vector2::Zero}
+{
+    /* DO NOTHING */
+}
+
+City::City(GameStateMain* world, Vector2 position) noexcept
+    : m_world{world}
+    , m_position{position}
 {
     /* DO NOTHING */
 }
@@ -29,18 +37,8 @@ void City::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexcept {
     /* DO NOTHING */
 }
 
-void City::Render() const noexcept {
-    auto* mat = g_theRenderer->GetMaterial("city");
-    auto* tex = mat->GetTexture(Material::TextureID::Diffuse);
-    const auto&& [x, y, _] = tex->GetDimensions().GetXYZ();
-    const auto dims = IntVector2{ x, y };
-    const auto S = Matrix4::CreateScaleMatrix(Vector2{ dims });
-    const auto R = Matrix4::I;
-    const auto T = Matrix4::CreateTranslationMatrix(m_position);
-    const auto M = Matrix4::MakeSRT(S, R, T);
-    g_theRenderer->SetMaterial(mat);
-    g_theRenderer->DrawQuad2D(M, GetCityColor());
-
+void City::AppendToSnapshot(RenderSnapshot& snapshot) const noexcept {
+    snapshot.cities.push_back(RenderSnapshot::Sprite{m_position, GetCityColor()});
 }
 
 void City::DebugRender() const noexcept {
@@ -55,9 +53,7 @@ void City::EndFrame() noexcept {
 }
 
 Rgba City::GetCityColor() const noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-    return IsDead() ? state->GetGroundColor() : state->GetPlayerColor();
+    return IsDead() ? m_world->GetGroundColor() : m_world->GetPlayerColor();
 }
 
 AABB2 City::GetCollisionMesh() const noexcept {
@@ -73,9 +69,17 @@ bool City::IsAlive() const noexcept {
 }
 
 void City::Kill() noexcept {
+    if (IsAlive()) {
+        m_world->InvalidateStaticScene();
+        m_world->InvalidateTargets();
+    }
     m_health = 0;
 }
 
 void City::Resurrect() noexcept {
+    if (IsDead()) {
+        m_world->InvalidateStaticScene();
+        m_world->InvalidateTargets();
+    }
     m_health = 1;
 }
@@ -5,6 +5,10 @@
 
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/Vector2.hpp"
+
+class GameStateMain;
+struct RenderSnapshot;
+
 class City {
 public:
 
@@ -15,13 +19,14 @@ public:
     City& operator=(City&& other) = default;
     ~City() = default;
 
-    explicit City(Vector2 position) noexcept;
+    explicit City(GameStateMain* world) noexcept;
+    City(GameStateMain* world, Vector2 position) noexcept;
 
     void SetPosition(Vector2 position) noexcept;
 
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) const noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -38,6 +43,7 @@ private:
 
     Rgba GetCityColor() const noexcept;
 
+    GameStateMain* m_world{nullptr};
     Vector2 m_position{};
     int m_health{1};
 };
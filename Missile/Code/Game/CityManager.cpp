@@ -1,7 +1,15 @@
 #include "Game/CityManager.hpp"
 
+#include "Game/RenderSnapshot.hpp"
+
 #include <algorithm>
 
+CityManager::CityManager(GameStateMain* world) noexcept
+    : m_cities{City{world}, City{world}, City{world}, City{world}, City{world}, City{world}}
+{
+    /* DO NOTHING */
+}
+
 void CityManager::BeginFrame() noexcept {
     for(auto& city : m_cities) {
         city.BeginFrame();
@@ -14,9 +22,9 @@ void CityManager::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
     }
 }
 
-void CityManager::Render() const noexcept {
+void CityManager::AppendToSnapshot(RenderSnapshot& snapshot) const noexcept {
     for (auto& city : m_cities) {
-        city.Render();
+        city.AppendToSnapshot(snapshot);
     }
 }
 
@@ -7,12 +7,17 @@
 #include <array>
 #include <bitset>
 
+class GameStateMain;
+
 class CityManager {
 public:
 
+    CityManager() = delete;
+    explicit CityManager(GameStateMain* world) noexcept;
+
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) const noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -27,7 +27,40 @@
 #include <format>
 #include <utility>
 
-EnemyWave::EnemyWave() noexcept {
+namespace {
+    std::span<const WaveDefinition> GetWaveDefinitions() noexcept {
+        if (const auto* g = GetGameAs<Game>(); g != nullptr) {
+            return g->GetWaveTable().GetWaves();
+        }
+        return {};
+    }
+}
+
+WaveParams WaveParams::ForWave(std::span<const WaveDefinition> waves, std::size_t waveId) noexcept {
+    const auto fallback = std::span<const WaveDefinition>{ &WaveTable::fallback_wave, 1u };
+    if (waves.empty()) {
+        waves = fallback;
+    }
+    const auto& wave = waves[(std::min)(waveId, waves.size() - 1u)];
+    const auto& colors = waves[waveId % waves.size()];
+    auto result = WaveParams{};
+    result.scoreMultiplier = wave.scoreMultiplier;
+    result.missileCount = wave.missileCount;
+    result.missileImpactTime = TimeUtils::FPSeconds{wave.missileImpactSeconds};
+    result.flierCooldown = wave.flierCooldownFrames;
+    result.flierFireRate = wave.flierFireRateFrames;
+    result.objectColor = Rgba(colors.objectColor);
+    result.playerColor = Rgba(colors.playerColor);
+    result.groundColor = Rgba(colors.groundColor);
+    result.backgroundColor = Rgba(colors.backgroundColor);
+    return result;
+}
+
+EnemyWave::EnemyWave(GameStateMain* world) noexcept
+    : m_world{world}
+    , m_waveParams{WaveParams::ForWave(GetWaveDefinitions(), 0u)}
+    , m_fliers{world}
+{
     m_currentState = std::move(std::make_unique<EnemyWaveStatePrewave>(this));
 }
 
@@ -35,6 +68,7 @@ void EnemyWave::BeginFrame() noexcept {
     if (m_nextState) {
         m_currentState->OnExit();
         m_currentState = std::move(m_nextState);
+        m_activeState = dynamic_cast<EnemyWaveStateActive*>(m_currentState.get());
         m_currentState->OnEnter();
         m_nextState.reset(nullptr);
     }
@@ -45,8 +79,8 @@ void EnemyWave::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
     m_currentState->Update(deltaSeconds);
 }
 
-void EnemyWave::Render() const noexcept {
-    m_currentState->Render();
+void EnemyWave::AppendToSnapshot(RenderSnapshot& snapshot) noexcept {
+    m_currentState->AppendToSnapshot(snapshot);
 }
 
 void EnemyWave::DebugRender() const noexcept {
@@ -65,45 +99,48 @@ EnemyWaveState* EnemyWave::GetCurrentState() noexcept {
     return m_currentState.get();
 }
 
+const GameStateMain* EnemyWave::GetWorld() const noexcept {
+    return m_world;
+}
+
+GameStateMain* EnemyWave::GetWorld() noexcept {
+    return m_world;
+}
+
 void EnemyWave::ChangeState(std::unique_ptr<EnemyWaveState> newState) noexcept {
     m_nextState = std::move(newState);
 }
 
 float EnemyWave::GetFlierCooldown() const noexcept {
-    return m_waveId < GameConstants::wave_flier_cooldown_lookup.size() ? GameConstants::wave_flier_cooldown_lookup[m_waveId] : GameConstants::min_bomber_cooldown;
+    return m_waveParams.flierCooldown;
 }
 
 bool EnemyWave::CanSpawnMissile() const noexcept {
-    auto* state = GetCurrentState();
-    if (auto* active_state = dynamic_cast<const EnemyWaveStateActive*>(state); active_state != nullptr) {
-        return active_state->CanSpawnMissile();
+    if (m_activeState != nullptr) {
+        return m_activeState->CanSpawnMissile();
     }
     return false;
 }
 
 bool EnemyWave::LaunchMissileFrom(Vector2 position) noexcept {
-    auto* state = GetCurrentState();
-    if (auto* active_state = dynamic_cast<EnemyWaveStateActive*>(state); active_state != nullptr) {
-        return active_state->LaunchMissileFrom(position);
+    if (m_activeState != nullptr) {
+        return m_activeState->LaunchMissileFrom(position);
     }
     return false;
 }
 
 const MissileManager* EnemyWave::GetMissileManager() const noexcept {
-    const auto* state = GetCurrentState();
-    if (const auto* main_state = dynamic_cast<const EnemyWaveStateActive*>(state); main_state != nullptr) {
-        return main_state->GetMissileManager();
+    if (m_activeState != nullptr) {
+        return m_activeState->GetMissileManager();
     }
     return nullptr;
 }
 
 MissileManager* EnemyWave::GetMissileManager() noexcept {
-    auto* state = GetCurrentState();
-    if (auto* main_state = dynamic_cast<EnemyWaveStateActive*>(state); main_state != nullptr) {
-        return main_state->GetMissileManager();
+    if (m_activeState != nullptr) {
+        return m_activeState->GetMissileManager();
     }
     return nullptr;
-
 }
 
 std::size_t EnemyWave::GetWaveId() const noexcept {
@@ -112,38 +149,42 @@ std::size_t EnemyWave::GetWaveId() const noexcept {
 
 void EnemyWave::IncrementWave() noexcept {
     m_waveId += 1;
+    m_waveParams = WaveParams::ForWave(GetWaveDefinitions(), m_waveId);
+    m_world->InvalidateStaticScene();
+    m_world->PublishEvent(GameEvent{GameEventType::WaveChanged, Faction::None, Vector2::Zero, static_cast<int>(m_waveId)});
+}
+
+void EnemyWave::ReloadWaveParams() noexcept {
+    m_waveParams = WaveParams::ForWave(GetWaveDefinitions(), m_waveId);
+    m_world->InvalidateStaticScene();
+}
+
+const WaveParams& EnemyWave::GetWaveParams() const noexcept {
+    return m_waveParams;
 }
 
 int EnemyWave::GetScoreMultiplier() const noexcept {
-    return m_waveId < GameConstants::wave_score_multiplier_lookup.size() ? GameConstants::wave_score_multiplier_lookup[m_waveId] : GameConstants::max_score_multiplier;
+    return m_waveParams.scoreMultiplier;
 }
 
 Rgba EnemyWave::GetObjectColor() const noexcept {
-    return Rgba(GameConstants::wave_object_color_lookup[m_waveId % GameConstants::wave_array_size]);
+    return m_waveParams.objectColor;
 }
 
 Rgba EnemyWave::GetBackgroundColor() const noexcept {
-    return Rgba(GameConstants::wave_background_color_lookup[m_waveId % GameConstants::wave_array_size]);
+    return m_waveParams.backgroundColor;
 }
 
 TimeUtils::FPSeconds EnemyWave::GetMissileImpactTime() const noexcept {
-    return TimeUtils::FPSeconds{m_waveId < GameConstants::wave_missile_impact_time.size() ? GameConstants::wave_missile_impact_time[m_waveId] : GameConstants::min_missile_impact_time};
+    return m_waveParams.missileImpactTime;
 }
 
-Bomber* const EnemyWave::GetBomber() const noexcept {
-    const auto* state = GetCurrentState();
-    if (const auto* active_state = dynamic_cast<const EnemyWaveStateActive*>(state); active_state != nullptr) {
-        return active_state->GetBomber();
-    }
-    return nullptr;
+const FlierPool& EnemyWave::GetFliers() const noexcept {
+    return m_fliers;
 }
 
-Satellite* const EnemyWave::GetSatellite() const noexcept {
-    const auto* state = GetCurrentState();
-    if (const auto* active_state = dynamic_cast<const EnemyWaveStateActive*>(state); active_state != nullptr) {
-        return active_state->GetSatellite();
-    }
-    return nullptr;
+FlierPool& EnemyWave::GetFliers() noexcept {
+    return m_fliers;
 }
 
 void EnemyWave::DecrementMissileCount() noexcept {
@@ -151,7 +192,7 @@ void EnemyWave::DecrementMissileCount() noexcept {
 }
 
 int EnemyWave::GetMissileCountForWave() const noexcept {
-    return m_waveId < GameConstants::wave_missile_count_lookup.size() ? GameConstants::wave_missile_count_lookup[m_waveId] : GameConstants::max_enemy_missile_count;
+    return m_waveParams.missileCount;
 }
 
 void EnemyWave::SetMissileSpawnRate(TimeUtils::FPSeconds secondsBetween) noexcept {
@@ -5,15 +5,34 @@
 #include "Game/EnemyWaveState.hpp"
 
 #include "Game/MissileManager.hpp"
-#include "Game/Bomber.hpp"
-#include "Game/Satellite.hpp"
+#include "Game/FlierPool.hpp"
+#include "Game/WaveTable.hpp"
 
 #include <cstdint>
 #include <memory>
+#include <span>
+
+class GameStateMain;
+class EnemyWaveStateActive;
+
+struct WaveParams {
+    int scoreMultiplier{1};
+    int missileCount{0};
+    TimeUtils::FPSeconds missileImpactTime{};
+    float flierCooldown{};
+    float flierFireRate{};
+    Rgba objectColor{};
+    Rgba playerColor{};
+    Rgba groundColor{};
+    Rgba backgroundColor{};
+
+    //Waves past the last definition keep its numbers and cycle through every definition's colors.
+    static WaveParams ForWave(std::span<const WaveDefinition> waves, std::size_t waveId) noexcept;
+};
 
 class EnemyWave {
 public:
-    EnemyWave() noexcept;
+    explicit EnemyWave(GameStateMain* world) noexcept;
     EnemyWave(const EnemyWave& other) = default;
     EnemyWave(EnemyWave&& other) = default;
     EnemyWave& operator=(const EnemyWave& other) = default;
@@ -22,7 +41,7 @@ public:
 
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -31,14 +50,17 @@ public:
 
     std::size_t GetWaveId() const noexcept;
     void IncrementWave() noexcept;
+    //Re-reads the current wave's parameters, e.g. after the wave table is reloaded. Remaining missiles are kept.
+    void ReloadWaveParams() noexcept;
+    const WaveParams& GetWaveParams() const noexcept;
 
     int GetScoreMultiplier() const noexcept;
     Rgba GetObjectColor() const noexcept;
     Rgba GetBackgroundColor() const noexcept;
     TimeUtils::FPSeconds GetMissileImpactTime() const noexcept;
 
-    Bomber* const GetBomber() const noexcept;
-    Satellite* const GetSatellite() const noexcept;
+    const FlierPool& GetFliers() const noexcept;
+    FlierPool& GetFliers() noexcept;
 
     void DecrementMissileCount() noexcept;
     void SetMissileCount(int newMissileCount) noexcept;
@@ -59,12 +81,19 @@ public:
     const EnemyWaveState* GetCurrentState() const noexcept;
     EnemyWaveState* GetCurrentState() noexcept;
 
+    const GameStateMain* GetWorld() const noexcept;
+    GameStateMain* GetWorld() noexcept;
+
     void ChangeState(std::unique_ptr<EnemyWaveState> newState) noexcept;
 protected:
 private:
+    GameStateMain* m_world{nullptr};
     std::size_t m_waveId{ 0 };
+    WaveParams m_waveParams{};
+    FlierPool m_fliers{};
     std::unique_ptr<EnemyWaveState> m_currentState{};
     std::unique_ptr<EnemyWaveState> m_nextState{};
+    EnemyWaveStateActive* m_activeState{nullptr};
     Stopwatch m_missileSpawnRate{};
     Stopwatch m_flierSpawnRate{};
     int m_missileCount{0};
@@ -5,9 +5,8 @@
 
 #include "Game/EnemyWaveState.hpp"
 
-#include "Game/Bomber.hpp"
+#include "Game/FlierPool.hpp"
 #include "Game/MissileManager.hpp"
-#include "Game/Satellite.hpp"
 
 #include <memory>
 
@@ -26,17 +25,13 @@ public:
     void OnExit() noexcept override;
     void BeginFrame() noexcept override;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept override;
-    void Render() const noexcept override;
+    void AppendToSnapshot(RenderSnapshot& snapshot) noexcept override;
     void DebugRender() const noexcept override;
     void EndFrame() noexcept override;
 
     const MissileManager* GetMissileManager() const noexcept;
     MissileManager* GetMissileManager() noexcept;
 
-    Bomber* const GetBomber() const noexcept;
-
-    Satellite* const GetSatellite() const noexcept;
-
     bool CanSpawnMissile() const noexcept;
     bool LaunchMissileFrom(Vector2 position) noexcept;
 protected:
@@ -51,11 +46,12 @@ private:
 
     void SpawnSatellite() noexcept;
 
+    std::size_t GetMaxFliersPerKind() const noexcept;
+
     void SpawnMissile() noexcept;
 
     void UpdateMissiles(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void UpdateSatellite(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void UpdateBomber(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    void UpdateFliers(TimeUtils::FPSeconds deltaSeconds) noexcept;
 
     void AdvanceToNextWave() noexcept;
 
@@ -64,9 +60,7 @@ private:
     void RenderScoreMultiplierElement() const noexcept;
 
     EnemyWave* m_context{nullptr};
-    MissileManager m_missiles{};
-    std::unique_ptr<Bomber> m_bomber{};
-    std::unique_ptr<Satellite> m_satellite{};
+    MissileManager m_missiles;
     Stopwatch m_missileSpawnRate{};
     Stopwatch m_flierSpawnRate{};
 
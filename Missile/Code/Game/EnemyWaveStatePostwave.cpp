@@ -1,7 +1,5 @@
 #include "Game/EnemyWaveStatePostwave.hpp"
 
-#include "Engine/Audio/AudioSystem.hpp"
-
 #include "Engine/Core/EngineCommon.hpp"
 
 #include "Engine/Renderer/Renderer.hpp"
@@ -12,8 +10,6 @@
 #include "Game/EnemyWave.hpp"
 #include "Game/EnemyWaveStatePrewave.hpp"
 
-#include <format>
-
 static Clay_LayoutConfig fullscreen_layout = {
     .sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_GROW(0)},
     .padding = CLAY_PADDING_ALL(0),
@@ -31,9 +27,7 @@ EnemyWaveStatePostwave::EnemyWaveStatePostwave(EnemyWave* context) noexcept
 }
 
 void EnemyWaveStatePostwave::OnEnter() noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = g->GetCurrentState();
-    auto* main_state = dynamic_cast<GameStateMain*>(state);
+    auto* main_state = m_context->GetWorld();
 
     m_context->DeactivateWave();
     m_postWaveIncrementRate.Reset();
@@ -53,9 +47,7 @@ void EnemyWaveStatePostwave::OnEnter() noexcept {
 }
 
 void EnemyWaveStatePostwave::OnExit() noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = g->GetCurrentState();
-    auto* main_state = dynamic_cast<GameStateMain*>(state);
+    auto* main_state = m_context->GetWorld();
     if (m_grantedCityThisWave) {
         main_state->GetCityManager().RedeemBonusCity();
         if (std::any_of(std::begin(m_alive_cities), std::end(m_alive_cities), [](bool a) { return a == false; })) {
@@ -86,24 +78,25 @@ void EnemyWaveStatePostwave::OnExit() noexcept {
 
 void EnemyWaveStatePostwave::BeginFrame() noexcept {
     auto* g = GetGameAs<Game>();
-    auto* state = g->GetCurrentState();
-    auto* main_state = dynamic_cast<GameStateMain*>(state);
+    auto* main_state = m_context->GetWorld();
     if (main_state->HasMissilesRemaining()) {
         if (m_postWaveIncrementRate.CheckAndReset()) {
-            g->AdjustPlayerScore(GameConstants::unused_missile_value * m_context->GetScoreMultiplier());
+            const auto score = GameConstants::unused_missile_value * m_context->GetScoreMultiplier();
+            g->AdjustPlayerScore(score);
             main_state->DecrementTotalMissiles();
             ++m_missilesRemainingPostWave;
-            g_theAudioSystem->Play(GameConstants::game_audio_counting_path, AudioSystem::SoundDesc{});
+            main_state->PublishEvent(GameEvent{GameEventType::ScoreTallied, Faction::Player, Vector2::Zero, score});
         }
     } else if (main_state->GetCityManager().RemainingCitiesCount()) {
         if (m_postWaveIncrementRate.CheckAndReset()) {
             if (m_city_idx < GameConstants::max_cities) {
                 if (main_state->GetCityManager().GetCity(m_city_idx).IsAlive()) {
                     m_alive_cities[m_city_idx] = true;
-                    g->AdjustPlayerScore(GameConstants::saved_city_value * m_context->GetScoreMultiplier());
+                    const auto score = GameConstants::saved_city_value * m_context->GetScoreMultiplier();
+                    g->AdjustPlayerScore(score);
                     main_state->GetCityManager().GetCity(m_city_idx).Kill();
                     ++m_citiesRemainingPostWave;
-                    g_theAudioSystem->Play(GameConstants::game_audio_counting_path, AudioSystem::SoundDesc{});
+                    main_state->PublishEvent(GameEvent{GameEventType::ScoreTallied, Faction::Player, Vector2::Zero, score});
                 }
             }
             ++m_city_idx;
@@ -112,7 +105,7 @@ void EnemyWaveStatePostwave::BeginFrame() noexcept {
         if (m_postWaveIncrementRate.CheckAndReset() && !m_showBonusCityText) {
             m_grantedCityThisWave = true;
             m_showBonusCityText = true;
-            g_theAudioSystem->Play(GameConstants::game_audio_bonuscity_path, AudioSystem::SoundDesc{});
+            main_state->PublishEvent(GameEvent{GameEventType::BonusCity, Faction::Player, Vector2::Zero, 0});
         }
     } else {
         if (!m_canTransision) {
@@ -126,7 +119,7 @@ void EnemyWaveStatePostwave::Update([[maybe_unused]] TimeUtils::FPSeconds deltaS
     /* DO NOTHING */
 }
 
-void EnemyWaveStatePostwave::Render() const noexcept {
+void EnemyWaveStatePostwave::AppendToSnapshot([[maybe_unused]] RenderSnapshot& snapshot) noexcept {
     /* DO NOTHING */
 }
 
@@ -152,19 +145,9 @@ void EnemyWaveStatePostwave::ClayPostwave() noexcept {
 
 void EnemyWaveStatePostwave::RenderScoreElement() const noexcept {
     CLAY({ .id = CLAY_ID("Score"), .layout = {.sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_PERCENT(0.1f)}, .padding = CLAY_PADDING_ALL(0), .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_CENTER, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_TOP},}, .backgroundColor = Clay::RgbaToClayColor(Rgba::NoAlpha) }) {
-        static auto points_str = std::string{};
-        points_str = [this]()->std::string {
-            const auto player_score = GetGameAs<Game>()->GetPlayerScore();
-            const auto highscore = GetGameAs<Game>()->GetHighScore();
-            const auto wave = m_context->GetWaveId() + 1;
-            if (player_score > highscore) {
-                return std::format("{} <- {}\nWave: {}", player_score, highscore, wave);
-            } else {
-                return std::format("{} -> {}\nWave: {}", player_score, highscore, wave);
-            }
-            }();
+        const auto& points_str = m_context->GetWorld()->GetHud().GetScoreText();
         Clay_TextElementConfig textConfig{};
-        textConfig.userData = g_theRenderer->GetFont("System32");
+        textConfig.userData = m_context->GetWorld()->GetRenderHandles().GetFont();
         textConfig.textColor = Clay::RgbaToClayColor(Rgba::White);
         textConfig.wrapMode = Clay_TextElementConfigWrapMode::CLAY_TEXT_WRAP_NEWLINES;
         CLAY_TEXT(Clay::StrToClayString(points_str), CLAY_TEXT_CONFIG(textConfig));
@@ -173,30 +156,29 @@ void EnemyWaveStatePostwave::RenderScoreElement() const noexcept {
 
 void EnemyWaveStatePostwave::RenderScoreMultiplierElement() const noexcept {
     CLAY({ .id = CLAY_ID("ScoreMultiplier"), .layout = {.sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_GROW(0)}, .padding = CLAY_PADDING_ALL(0), .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_CENTER, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_CENTER}}, .backgroundColor = Clay::RgbaToClayColor(Rgba::NoAlpha) }) {
-        static auto points_str = std::string{};
-        points_str = std::format("{} X POINTS", m_context->GetScoreMultiplier());
+        const auto& points_str = m_context->GetWorld()->GetHud().GetMultiplierText();
         Clay_TextElementConfig textConfig{};
-        textConfig.userData = g_theRenderer->GetFont("System32");
+        textConfig.userData = m_context->GetWorld()->GetRenderHandles().GetFont();
         textConfig.textColor = Clay::RgbaToClayColor(m_context->GetObjectColor());
         CLAY_TEXT(Clay::StrToClayString(points_str), CLAY_TEXT_CONFIG(textConfig));
     }
 }
 
 void EnemyWaveStatePostwave::RenderPostWaveStatsElement() const noexcept {
-    const Clay_TextElementConfig textConfig{ .userData = g_theRenderer->GetFont("System32"), .textColor = Clay::RgbaToClayColor(m_context->GetObjectColor()) };
+    const Clay_TextElementConfig textConfig{ .userData = m_context->GetWorld()->GetRenderHandles().GetFont(), .textColor = Clay::RgbaToClayColor(m_context->GetObjectColor()) };
 
     CLAY({ .id = CLAY_ID("PostwaveStatsContainer"), .layout = {.sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_GROW(0)}, .childGap = 16, .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_CENTER, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_TOP}, .layoutDirection = Clay_LayoutDirection::CLAY_TOP_TO_BOTTOM,}, .backgroundColor = Clay::RgbaToClayColor(Rgba::NoAlpha) }) {
         CLAY_TEXT(CLAY_STRING_CONST("BONUS POINTS"), CLAY_TEXT_CONFIG(textConfig));
         CLAY_TEXT(CLAY_STRING_CONST("MISSILES"), CLAY_TEXT_CONFIG(textConfig));
         {
-            const auto dims = Clay::Vector2ToClayDimensions(Vector2(IntVector2(g_theRenderer->GetMaterial("missile")->GetTexture(Material::TextureID::Diffuse)->GetDimensions())));
+            const auto dims = Clay::Vector2ToClayDimensions(m_context->GetWorld()->GetRenderHandles().GetSprite(SpriteId::Missile).dimensions);
             CLAY({ .id = CLAY_ID("MissileImagesContainer"), .layout = {.sizing = {.width = CLAY_SIZING_FIXED(dims.width * GameConstants::max_player_missile_count), .height = CLAY_SIZING_FIXED(dims.height)}, .childGap = 8, .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_LEFT, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_CENTER}, .layoutDirection = Clay_LayoutDirection::CLAY_LEFT_TO_RIGHT} }) {
                 RenderMissileImageElements();
             }
         }
         CLAY_TEXT(CLAY_STRING_CONST("CITIES"), CLAY_TEXT_CONFIG(textConfig));
         {
-            const auto dims = Clay::Vector2ToClayDimensions(Vector2(IntVector2(g_theRenderer->GetMaterial("city")->GetTexture(Material::TextureID::Diffuse)->GetDimensions())));
+            const auto dims = Clay::Vector2ToClayDimensions(m_context->GetWorld()->GetRenderHandles().GetSprite(SpriteId::City).dimensions);
             CLAY({ .id = CLAY_ID("CityImagesContainer"), .layout = {.sizing = {.width = CLAY_SIZING_FIXED(dims.width * GameConstants::max_cities), .height = CLAY_SIZING_FIXED(dims.height)}, .childGap = static_cast<uint8_t>(dims.width + 8), .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_LEFT, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_CENTER}, .layoutDirection = Clay_LayoutDirection::CLAY_LEFT_TO_RIGHT} }) {
                 RenderCityImageElements();
             }
@@ -204,17 +186,10 @@ void EnemyWaveStatePostwave::RenderPostWaveStatsElement() const noexcept {
         if (m_showBonusCityText) {
             CLAY({ .layout = {.sizing = {}, .padding = {0, 0, 16, 0}, .childGap = 16, .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_LEFT, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_CENTER}, .layoutDirection = Clay_LayoutDirection::CLAY_LEFT_TO_RIGHT} }) {
                 CLAY_TEXT(CLAY_STRING_CONST("BONUS CITY"), CLAY_TEXT_CONFIG(textConfig));
-                const auto player_color = []()->Rgba {
-                    if (const auto* g = GetGameAs<Game>(); g != nullptr) {
-                        if (auto* mainState = dynamic_cast<GameStateMain*>(g->GetCurrentState()); mainState != nullptr) {
-                            return mainState->GetPlayerColor();
-                        }
-                        return Rgba::Black;
-                    }
-                    return Rgba::Black;
-                    }();
-                const auto mat = g_theRenderer->GetMaterial("city");
-                const auto dims = Clay::Vector2ToClayDimensions(Vector2(IntVector2(mat->GetTexture(Material::TextureID::Diffuse)->GetDimensions())));
+                const auto player_color = m_context->GetWorld()->GetPlayerColor();
+                const auto& city = m_context->GetWorld()->GetRenderHandles().GetSprite(SpriteId::City);
+                const auto mat = city.material;
+                const auto dims = Clay::Vector2ToClayDimensions(city.dimensions);
                 CLAY({ .layout = {.sizing = {.width = CLAY_SIZING_FIXED(dims.width), .height = CLAY_SIZING_FIXED(dims.height)}},  .backgroundColor = Clay::RgbaToClayColor(player_color), .image = {.imageData = mat, .sourceDimensions = dims} }) {}
             }
         }
@@ -223,17 +198,10 @@ void EnemyWaveStatePostwave::RenderPostWaveStatsElement() const noexcept {
 
 
 void EnemyWaveStatePostwave::RenderCityImageElements() const noexcept {
-    const auto player_color = []()->Rgba {
-        if (const auto* g = GetGameAs<Game>(); g != nullptr) {
-            if (auto* mainState = dynamic_cast<GameStateMain*>(g->GetCurrentState()); mainState != nullptr) {
-                return mainState->GetPlayerColor();
-            }
-            return Rgba::Black;
-        }
-        return Rgba::Black;
-        }();
-    const auto mat = g_theRenderer->GetMaterial("city");
-    const auto dims = Clay::Vector2ToClayDimensions(Vector2(IntVector2(mat->GetTexture(Material::TextureID::Diffuse)->GetDimensions())));
+    const auto player_color = m_context->GetWorld()->GetPlayerColor();
+    const auto& city = m_context->GetWorld()->GetRenderHandles().GetSprite(SpriteId::City);
+    const auto mat = city.material;
+    const auto dims = Clay::Vector2ToClayDimensions(city.dimensions);
     std::size_t j = 1u;
     for (std::size_t i = m_citiesRemainingPostWave - (m_citiesRemainingPostWave - j); j <= m_citiesRemainingPostWave; ++i, ++j) {
         CLAY({ .backgroundColor = Clay::RgbaToClayColor(player_color), .image = {.imageData = mat, .sourceDimensions = dims} }) {}
@@ -241,17 +209,10 @@ void EnemyWaveStatePostwave::RenderCityImageElements() const noexcept {
 }
 
 void EnemyWaveStatePostwave::RenderMissileImageElements() const noexcept {
-    const auto player_color = []()->Rgba {
-        if (const auto* g = GetGameAs<Game>(); g != nullptr) {
-            if (auto* mainState = dynamic_cast<GameStateMain*>(g->GetCurrentState()); mainState != nullptr) {
-                return mainState->GetPlayerColor();
-            }
-            return Rgba::Black;
-        }
-        return Rgba::Black;
-        }();
-    const auto mat = g_theRenderer->GetMaterial("missile");
-    const auto dims = Clay::Vector2ToClayDimensions(Vector2(IntVector2(mat->GetTexture(Material::TextureID::Diffuse)->GetDimensions())));
+    const auto player_color = m_context->GetWorld()->GetPlayerColor();
+    const auto& missile = m_context->GetWorld()->GetRenderHandles().GetSprite(SpriteId::Missile);
+    const auto mat = missile.material;
+    const auto dims = Clay::Vector2ToClayDimensions(missile.dimensions);
     int j = 1;
     for (int i = m_missilesRemainingPostWave - (m_missilesRemainingPostWave - j); j <= m_missilesRemainingPostWave; ++i, ++j) {
         CLAY({ .backgroundColor = Clay::RgbaToClayColor(player_color), .image = {.imageData = mat, .sourceDimensions = dims} }) {}
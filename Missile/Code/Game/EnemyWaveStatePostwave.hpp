@@ -21,7 +21,7 @@ public:
     void OnExit() noexcept override;
     void BeginFrame() noexcept override;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept override;
-    void Render() const noexcept override;
+    void AppendToSnapshot(RenderSnapshot& snapshot) noexcept override;
     void DebugRender() const noexcept override;
     void EndFrame() noexcept override;
 
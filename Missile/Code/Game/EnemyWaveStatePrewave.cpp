@@ -12,8 +12,6 @@
 #include "Game/EnemyWave.hpp"
 #include "Game/EnemyWaveStateActive.hpp"
 
-#include <format>
-
 EnemyWaveStatePrewave::EnemyWaveStatePrewave(EnemyWave* context) noexcept
     : m_context(context)
 {
@@ -38,7 +36,7 @@ void EnemyWaveStatePrewave::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSe
     /* DO NOTHING */
 }
 
-void EnemyWaveStatePrewave::Render() const noexcept {
+void EnemyWaveStatePrewave::AppendToSnapshot([[maybe_unused]] RenderSnapshot& snapshot) noexcept {
     /* DO NOTHING */
 }
 
@@ -48,9 +46,7 @@ void EnemyWaveStatePrewave::DebugRender() const noexcept {
 
 void EnemyWaveStatePrewave::EndFrame() noexcept {
     if (m_preWaveTimer.CheckAndReset()) {
-        auto* g = GetGameAs<Game>();
-        auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-        state->ResetMissileCount();
+        m_context->GetWorld()->ResetMissileCount();
         m_context->ChangeState(std::make_unique<EnemyWaveStateActive>(m_context));
     }
 }
@@ -72,19 +68,9 @@ void EnemyWaveStatePrewave::ClayPrewave() noexcept {
 
 void EnemyWaveStatePrewave::RenderScoreElement() const noexcept {
     CLAY({ .id = CLAY_ID("Score"), .layout = {.sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_PERCENT(0.1f)}, .padding = CLAY_PADDING_ALL(0), .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_CENTER, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_TOP},}, .backgroundColor = Clay::RgbaToClayColor(Rgba::NoAlpha) }) {
-        static auto points_str = std::string{};
-        points_str = [this]()->std::string {
-            const auto player_score = GetGameAs<Game>()->GetPlayerScore();
-            const auto highscore = GetGameAs<Game>()->GetHighScore();
-            const auto wave = m_context->GetWaveId() + 1;
-            if (player_score > highscore) {
-                return std::format("{} <- {}\nWave: {}", player_score, highscore, wave);
-            } else {
-                return std::format("{} -> {}\nWave: {}", player_score, highscore, wave);
-            }
-            }();
+        const auto& points_str = m_context->GetWorld()->GetHud().GetScoreText();
         Clay_TextElementConfig textConfig{};
-        textConfig.userData = g_theRenderer->GetFont("System32");
+        textConfig.userData = m_context->GetWorld()->GetRenderHandles().GetFont();
         textConfig.textColor = Clay::RgbaToClayColor(Rgba::White);
         textConfig.wrapMode = Clay_TextElementConfigWrapMode::CLAY_TEXT_WRAP_NEWLINES;
         CLAY_TEXT(Clay::StrToClayString(points_str), CLAY_TEXT_CONFIG(textConfig));
@@ -93,10 +79,9 @@ void EnemyWaveStatePrewave::RenderScoreElement() const noexcept {
 
 void EnemyWaveStatePrewave::RenderScoreMultiplierElement() const noexcept {
     CLAY({ .id = CLAY_ID("ScoreMultiplier"), .layout = {.sizing = {.width = CLAY_SIZING_GROW(0), .height = CLAY_SIZING_GROW(0)}, .padding = CLAY_PADDING_ALL(0), .childAlignment = {.x = Clay_LayoutAlignmentX::CLAY_ALIGN_X_CENTER, .y = Clay_LayoutAlignmentY::CLAY_ALIGN_Y_CENTER}}, .backgroundColor = Clay::RgbaToClayColor(Rgba::NoAlpha) }) {
-        static auto points_str = std::string{};
-        points_str = std::format("{} X POINTS", m_context->GetScoreMultiplier());
+        const auto& points_str = m_context->GetWorld()->GetHud().GetMultiplierText();
         Clay_TextElementConfig textConfig{};
-        textConfig.userData = g_theRenderer->GetFont("System32");
+        textConfig.userData = m_context->GetWorld()->GetRenderHandles().GetFont();
         textConfig.textColor = Clay::RgbaToClayColor(m_context->GetObjectColor());
         CLAY_TEXT(Clay::StrToClayString(points_str), CLAY_TEXT_CONFIG(textConfig));
     }
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+struct EntityHandle {
+    static constexpr const std::uint32_t invalid_slot{0xFFFFFFFFu};
+    std::uint32_t slot{invalid_slot};
+    std::uint32_t generation{0u};
+};
+
+//One contiguous column per component type; row i of every column belongs to the same entity.
+//Destroying a row moves the last row into its place, so rows stay packed but are not stable. Use handles to refer to an entity across frames.
+template<typename... Components>
+class Archetype {
+public:
+    Archetype() = default;
+    Archetype(const Archetype& other) = default;
+    Archetype(Archetype&& other) = default;
+    Archetype& operator=(const Archetype& other) = default;
+    Archetype& operator=(Archetype&& other) = default;
+    ~Archetype() = default;
+
+    EntityHandle Create(Components... components) noexcept;
+    void Destroy(EntityHandle handle) noexcept;
+    void DestroyAt(std::size_t row) noexcept;
+    void Clear() noexcept;
+    void Reserve(std::size_t capacity) noexcept;
+
+    bool IsAlive(EntityHandle handle) const noexcept;
+    std::size_t RowOf(EntityHandle handle) const noexcept;
+    EntityHandle HandleAt(std::size_t row) const noexcept;
+    std::size_t Size() const noexcept;
+    bool Empty() const noexcept;
+
+    template<typename Component>
+    std::vector<Component>& Column() noexcept;
+    template<typename Component>
+    const std::vector<Component>& Column() const noexcept;
+
+    //Calls fn with a reference to each selected component of every row, in row order.
+    template<typename... Selected, typename Fn>
+    void Each(Fn&& fn) noexcept;
+    template<typename... Selected, typename Fn>
+    void Each(Fn&& fn) const noexcept;
+
+protected:
+private:
+    struct Slot {
+        std::uint32_t row{EntityHandle::invalid_slot};
+        std::uint32_t generation{0u};
+    };
+
+    std::tuple<std::vector<Components>...> m_columns{};
+    std::vector<std::uint32_t> m_rowToSlot{};
+    std::vector<Slot> m_slots{};
+    std::vector<std::uint32_t> m_freeSlots{};
+};
+
+template<typename... Components>
+EntityHandle Archetype<Components...>::Create(Components... components) noexcept {
+    auto slot = std::uint32_t{};
+    if (m_freeSlots.empty()) {
+        slot = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    } else {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    m_slots[slot].row = static_cast<std::uint32_t>(m_rowToSlot.size());
+    m_rowToSlot.push_back(slot);
+    (std::get<std::vector<Components>>(m_columns).push_back(std::move(components)), ...);
+    return EntityHandle{slot, m_slots[slot].generation};
+}
+
+template<typename... Components>
+void Archetype<Components...>::Destroy(EntityHandle handle) noexcept {
+    if (IsAlive(handle)) {
+        DestroyAt(m_slots[handle.slot].row);
+    }
+}
+
+template<typename... Components>
+void Archetype<Components...>::DestroyAt(std::size_t row) noexcept {
+    const auto last = m_rowToSlot.size() - 1u;
+    const auto slot = m_rowToSlot[row];
+    if (row != last) {
+        std::apply([row, last](auto&... column) { ((column[row] = std::move(column[last])), ...); }, m_columns);
+        m_rowToSlot[row] = m_rowToSlot[last];
+        m_slots[m_rowToSlot[row]].row = static_cast<std::uint32_t>(row);
+    }
+    std::apply([](auto&... column) { (column.pop_back(), ...); }, m_columns);
+    m_rowToSlot.pop_back();
+    m_slots[slot].row = EntityHandle::invalid_slot;
+    ++m_slots[slot].generation;
+    m_freeSlots.push_back(slot);
+}
+
+template<typename... Components>
+void Archetype<Components...>::Clear() noexcept {
+    while (!m_rowToSlot.empty()) {
+        DestroyAt(m_rowToSlot.size() - 1u);
+    }
+}
+
+template<typename... Components>
+void Archetype<Components...>::Reserve(std::size_t capacity) noexcept {
+    std::apply([capacity](auto&... column) { (column.reserve(capacity), ...); }, m_columns);
+    m_rowToSlot.reserve(capacity);
+    m_slots.reserve(capacity);
+    m_freeSlots.reserve(capacity);
+}
+
+template<typename... Components>
+bool Archetype<Components...>::IsAlive(EntityHandle handle) const noexcept {
+    return handle.slot < m_slots.size() && m_slots[handle.slot].generation == handle.generation && m_slots[handle.slot].row != EntityHandle::invalid_slot;
+}
+
+template<typename... Components>
+std::size_t Archetype<Components...>::RowOf(EntityHandle handle) const noexcept {
+    return m_slots[handle.slot].row;
+}
+
+template<typename... Components>
+EntityHandle Archetype<Components...>::HandleAt(std::size_t row) const noexcept {
+    const auto slot = m_rowToSlot[row];
+    return EntityHandle{slot, m_slots[slot].generation};
+}
+
+template<typename... Components>
+std::size_t Archetype<Components...>::Size() const noexcept {
+    return m_rowToSlot.size();
+}
+
+template<typename... Components>
+bool Archetype<Components...>::Empty() const noexcept {
+    return m_rowToSlot.empty();
+}
+
+template<typename... Components>
+template<typename Component>
+std::vector<Component>& Archetype<Components...>::Column() noexcept {
+    return std::get<std::vector<Component>>(m_columns);
+}
+
+template<typename... Components>
+template<typename Component>
+const std::vector<Component>& Archetype<Components...>::Column() const noexcept {
+    return std::get<std::vector<Component>>(m_columns);
+}
+
+template<typename... Components>
+template<typename... Selected, typename Fn>
+void Archetype<Components...>::Each(Fn&& fn) noexcept {
+    const auto columns = std::make_tuple(Column<Selected>().data()...);
+    const auto count = Size();
+    for (std::size_t i = 0u; i < count; ++i) {
+        fn(std::get<Selected*>(columns)[i]...);
+    }
+}
+
+template<typename... Components>
+template<typename... Selected, typename Fn>
+void Archetype<Components...>::Each(Fn&& fn) const noexcept {
+    const auto columns = std::make_tuple(Column<Selected>().data()...);
+    const auto count = Size();
+    for (std::size_t i = 0u; i < count; ++i) {
+        fn(std::get<const Selected*>(columns)[i]...);
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+//Bounded lock-free ring for many producers and a single consumer.
+//Each cell carries a sequence number so producers claim a cell with one CAS and publish it with one release store.
+template<typename T, std::size_t Capacity>
+class EventRing {
+public:
+    static_assert(Capacity != 0u && (Capacity & (Capacity - 1u)) == 0u, "EventRing capacity must be a power of two.");
+
+    EventRing() noexcept {
+        for (std::size_t i = 0u; i < Capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    EventRing(const EventRing& other) = delete;
+    EventRing(EventRing&& other) = delete;
+    EventRing& operator=(const EventRing& other) = delete;
+    EventRing& operator=(EventRing&& other) = delete;
+    ~EventRing() = default;
+
+    //Safe from any thread. Returns false without blocking when the ring is full.
+    bool TryPush(const T& value) noexcept {
+        auto pos = m_writePos.load(std::memory_order_relaxed);
+        Cell* cell{nullptr};
+        for (;;) {
+            cell = &m_cells[pos & mask];
+            const auto sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (m_writePos.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_writePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(pos + 1u, std::memory_order_release);
+        return true;
+    }
+
+    //Consumer thread only.
+    bool TryPop(T& value) noexcept {
+        auto& cell = m_cells[m_readPos & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_readPos + 1u) {
+            return false;
+        }
+        value = cell.value;
+        cell.sequence.store(m_readPos + Capacity, std::memory_order_release);
+        ++m_readPos;
+        return true;
+    }
+
+protected:
+private:
+    static constexpr const std::size_t mask{Capacity - 1u};
+    static constexpr const std::size_t cache_line_size{64u};
+
+    struct Cell {
+        std::atomic<std::size_t> sequence{0u};
+        T value{};
+    };
+
+    std::array<Cell, Capacity> m_cells{};
+    alignas(cache_line_size) std::atomic<std::size_t> m_writePos{0u};
+    alignas(cache_line_size) std::size_t m_readPos{0u};
+};
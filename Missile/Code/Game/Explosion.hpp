@@ -6,45 +6,27 @@
 #include "Engine/Math/Disc2.hpp"
 #include "Engine/Math/Vector2.hpp"
 
-#include "Engine/Renderer/Mesh.hpp"
-
+#include "Game/EntityRegistry.hpp"
 #include "Game/GameCommon.hpp"
 
-class Explosion {
-public:
-
-    Explosion() = default;
-    Explosion(const Explosion& other) = default;
-    Explosion(Explosion&& other) = default;
-    Explosion& operator=(const Explosion& other) = default;
-    Explosion& operator=(Explosion&& other) = default;
-    ~Explosion() = default;
-
-    Explosion(Vector2 position, float maxRadius, TimeUtils::FPSeconds lifetime, Faction faction = Faction::None) noexcept;
-
-    void BeginFrame() noexcept;
-    void Update(TimeUtils::FPSeconds deltaTime) noexcept;
-    void AppendToMesh(Mesh::Builder& builder) noexcept;
-    void EndFrame() noexcept;
-
-    bool IsDead() const noexcept;
-    Disc2 GetCollisionMesh() const noexcept;
-    Rgba GetColor() const noexcept;
+struct ExplosionShape {
+    Vector2 position{};
+    float maxRadius{};
+    float currentRadius{};
+};
 
-    void SetFaction(Faction newFaction) noexcept;
-    Faction GetFaction() noexcept;
+struct ExplosionLifetime {
+    TimeUtils::FPSeconds t{TimeUtils::FPSeconds::zero()};
+    TimeUtils::FPSeconds ttl{1.0f};
+};
 
-protected:
-private:
+using ExplosionArchetype = Archetype<ExplosionShape, ExplosionLifetime, Rgba, Faction>;
 
-    void DoSizeEaseOut() noexcept;
+namespace ExplosionSystems {
+    //Explosions flash a new random color every frame.
+    void Recolor(ExplosionArchetype& explosions) noexcept;
+    void Update(ExplosionArchetype& explosions, TimeUtils::FPSeconds deltaTime) noexcept;
 
-    Vector2 _position{};
-    float _max_radius{};
-    float _current_radius{};
-    TimeUtils::FPSeconds _t{TimeUtils::FPSeconds::zero()};
-    TimeUtils::FPSeconds _ttl{1.0f};
-    static inline int idx{0};
-    Rgba _color{};
-    Faction m_faction{Faction::None};
-};
+    bool IsDead(const ExplosionLifetime& lifetime) noexcept;
+    Disc2 GetCollisionMesh(const ExplosionShape& shape) noexcept;
+}
@@ -4,72 +4,53 @@
 
 #include "Engine/Renderer/Renderer.hpp"
 
-#include <algorithm>
+#include "Game/RenderSnapshot.hpp"
 
 void ExplosionManager::BeginFrame() noexcept {
-    if(m_deadExplosions.size() < m_explosions.size()) {
-        m_deadExplosions.reserve(static_cast<std::size_t>(std::ceil(1.5f * (m_deadExplosions.size() + m_explosions.size()))));
-    }
-    for (auto& e : m_explosions) {
-        e.BeginFrame();
-    }
+    ExplosionSystems::Recolor(m_explosions);
 }
 
 void ExplosionManager::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
-    for (auto& e : m_explosions) {
-        e.Update(deltaSeconds);
-    }
-    for (std::size_t i = 0u; i < m_explosions.size(); ++i) {
-        if (m_explosions[i].IsDead()) {
-            m_deadExplosions.push_back(i);
-        }
-    }
+    ExplosionSystems::Update(m_explosions, deltaSeconds);
 }
 
-void ExplosionManager::Render() const noexcept {
-    g_theRenderer->SetModelMatrix();
-    g_theRenderer->SetMaterial(g_theRenderer->GetMaterial("__2D"));
-    for (const auto& e : m_explosions) {
-        const auto& c = e.GetCollisionMesh();
-        g_theRenderer->DrawFilledCircle2D(c.center, c.radius, e.GetColor());
-    }
+void ExplosionManager::AppendToSnapshot(RenderSnapshot& snapshot) const noexcept {
+    m_explosions.Each<ExplosionShape, Rgba>([&snapshot](const ExplosionShape& shape, const Rgba& color) {
+        snapshot.explosions.push_back(RenderSnapshot::Disc{shape.position, shape.currentRadius, color});
+    });
 }
 
 void ExplosionManager::DebugRender() const noexcept {
     g_theRenderer->SetModelMatrix();
     g_theRenderer->SetMaterial(g_theRenderer->GetMaterial("__2D"));
-    for (const auto& e : m_explosions) {
-        const auto& c = e.GetCollisionMesh();
-        g_theRenderer->DrawCircle2D(c.center, c.radius, Rgba::Orange);
+    for (const auto& shape : m_explosions.Column<ExplosionShape>()) {
+        g_theRenderer->DrawCircle2D(shape.position, shape.currentRadius, Rgba::Orange);
     }
 }
 
 void ExplosionManager::EndFrame() noexcept {
-    for (auto& e : m_explosions) {
-        e.EndFrame();
-    }
-    std::sort(std::begin(m_deadExplosions), std::end(m_deadExplosions), std::greater<std::size_t>());
-    for (const auto& i : m_deadExplosions) {
-        std::swap(m_explosions[i], m_explosions.back());
-        m_explosions.pop_back();
+    const auto& lifetimes = m_explosions.Column<ExplosionLifetime>();
+    for (auto i = m_explosions.Size(); i-- > 0u;) {
+        if (ExplosionSystems::IsDead(lifetimes[i])) {
+            m_explosions.DestroyAt(i);
+        }
     }
-    m_deadExplosions.clear();
 }
 
 void ExplosionManager::CreateExplosionAt(ExplosionData&& newExplosionData) noexcept {
-    m_explosions.emplace_back(newExplosionData.position2_radius_ttlSeconds.GetXY(), newExplosionData.position2_radius_ttlSeconds.z, TimeUtils::FPSeconds{ newExplosionData.position2_radius_ttlSeconds.w}, newExplosionData.faction);
+    const auto& data = newExplosionData.position2_radius_ttlSeconds;
+    m_explosions.Create(ExplosionShape{data.GetXY(), data.z, 0.0f}, ExplosionLifetime{TimeUtils::FPSeconds::zero(), TimeUtils::FPSeconds{data.w}}, Rgba::Random(), newExplosionData.faction);
 }
 
 std::vector<Disc2> ExplosionManager::GetExplosionCollisionMeshes() const noexcept {
     std::vector<Disc2> results;
-    results.reserve(m_explosions.size());
-    for(const auto& e : m_explosions) {
-        results.push_back(e.GetCollisionMesh());
+    results.reserve(m_explosions.Size());
+    for (const auto& shape : m_explosions.Column<ExplosionShape>()) {
+        results.push_back(ExplosionSystems::GetCollisionMesh(shape));
     }
     return results;
 }
 
 std::size_t ExplosionManager::ActiveExplosionCount() const noexcept {
-    return m_explosions.size();
+    return m_explosions.Size();
 }
-
@@ -5,13 +5,13 @@
 #include "Engine/Math/Disc2.hpp"
 #include "Engine/Math/Vector2.hpp"
 
-#include "Engine/Renderer/Mesh.hpp"
-
 #include "Game/Explosion.hpp"
 #include "Game/GameCommon.hpp"
 
 #include <vector>
 
+struct RenderSnapshot;
+
 class ExplosionManager {
 public:
     struct ExplosionData {
@@ -21,7 +21,7 @@ public:
 
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) const noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -32,7 +32,5 @@ public:
 
 protected:
 private:
-    mutable Mesh::Builder m_builder{};
-    std::vector<Explosion> m_explosions{};
-    std::vector<std::size_t> m_deadExplosions{};
+    ExplosionArchetype m_explosions{};
 };
@@ -0,0 +1,144 @@
+#include "Game/FlierPool.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+
+#include "Game/GameStateMain.hpp"
+#include "Game/RenderSnapshot.hpp"
+
+FlierPool::FlierPool(GameStateMain* world) noexcept
+    : m_world{world}
+{
+    m_fliers.Reserve(GameConstants::flier_pool_capacity);
+    m_firingPositions.reserve(GameConstants::flier_pool_capacity);
+}
+
+void FlierPool::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
+    m_firingPositions.clear();
+    m_fliers.Each<FlierMotion, FlierWeapon, FlierStatus>([this, deltaSeconds](FlierMotion& motion, FlierWeapon& weapon, const FlierStatus& status) {
+        if (status.health < 1) {
+            return;
+        }
+        motion.position.x += motion.velocityX * deltaSeconds.count();
+        weapon.timeToFire -= deltaSeconds;
+        if (weapon.timeToFire <= TimeUtils::FPSeconds::zero()) {
+            weapon.timeToFire = weapon.fireRate;
+            m_firingPositions.push_back(motion.position);
+        }
+    });
+}
+
+void FlierPool::AppendToSnapshot(RenderSnapshot& snapshot, Rgba objectColor) const noexcept {
+    m_fliers.Each<FlierMotion, FlierStatus>([&](const FlierMotion& motion, const FlierStatus& status) {
+        if (status.health < 1) {
+            return;
+        }
+        if (status.kind == FlierKind::Bomber) {
+            snapshot.bombers.push_back(RenderSnapshot::Sprite{motion.position, objectColor});
+            return;
+        }
+        const auto& p = motion.position;
+        const auto r = motion.radius;
+        snapshot.AddLine(RenderSubsystem::Fliers, RenderSnapshot::Line{p + Vector2{ -1.5f, -1.5f } * r, p + Vector2{ +1.5f, +1.5f } * r, objectColor});
+        snapshot.AddLine(RenderSubsystem::Fliers, RenderSnapshot::Line{p + Vector2{ +1.5f, -1.5f } * r, p + Vector2{ -1.5f, +1.5f } * r, objectColor});
+        const auto light_color = Rgba::Random();
+        snapshot.AddPoint(RenderSubsystem::Fliers, RenderSnapshot::Point{p + Vector2{ -1.5f, -1.5f } * r, light_color});
+        snapshot.AddPoint(RenderSubsystem::Fliers, RenderSnapshot::Point{p + Vector2{ +1.5f, -1.5f } * r, light_color});
+        snapshot.AddPoint(RenderSubsystem::Fliers, RenderSnapshot::Point{p + Vector2{ -1.5f, +1.5f } * r, light_color});
+        snapshot.AddPoint(RenderSubsystem::Fliers, RenderSnapshot::Point{p + Vector2{ +1.5f, +1.5f } * r, light_color});
+        snapshot.satellites.push_back(RenderSnapshot::Disc{motion.position, motion.radius, objectColor});
+    });
+}
+
+void FlierPool::DebugRender() const noexcept {
+    if (m_fliers.Empty()) {
+        return;
+    }
+    g_theRenderer->SetMaterial("__2D");
+    g_theRenderer->SetModelMatrix();
+    m_fliers.Each<FlierMotion, FlierStatus>([](const FlierMotion& motion, const FlierStatus& status) {
+        if (status.health < 1) {
+            return;
+        }
+        g_theRenderer->DrawCircle2D(Disc2{motion.position, motion.radius}, Rgba::Orange);
+    });
+}
+
+void FlierPool::EndFrame() noexcept {
+    const auto& motions = m_fliers.Column<FlierMotion>();
+    const auto& statuses = m_fliers.Column<FlierStatus>();
+    for (auto i = m_fliers.Size(); i-- > 0u;) {
+        if (statuses[i].health < 1) {
+            m_world->CreateExplosionAt(motions[i].position, Faction::Player);
+            --m_counts[static_cast<std::size_t>(statuses[i].kind)];
+            m_fliers.DestroyAt(i);
+        }
+    }
+}
+
+bool FlierPool::Spawn(FlierKind kind, Vector2 position, TimeUtils::FPSeconds fireRate) noexcept {
+    if (GameConstants::flier_pool_capacity <= m_fliers.Size()) {
+        return false;
+    }
+    const auto is_bomber = kind == FlierKind::Bomber;
+    const auto velocity_x = is_bomber ? GameConstants::bomber_speed : -GameConstants::satellite_speed;
+    const auto radius = is_bomber ? GameConstants::bomber_radius : GameConstants::satellite_radius;
+    m_fliers.Create(FlierMotion{position, velocity_x, radius}, FlierWeapon{fireRate, fireRate}, FlierStatus{1, kind});
+    ++m_counts[static_cast<std::size_t>(kind)];
+    m_world->PublishEvent(GameEvent{GameEventType::FlierSpawned, Faction::Enemy, position, static_cast<int>(kind)});
+    return true;
+}
+
+std::size_t FlierPool::RemoveOffscreen(const AABB2& bounds) noexcept {
+    auto removed = std::size_t{0u};
+    const auto& motions = m_fliers.Column<FlierMotion>();
+    const auto& statuses = m_fliers.Column<FlierStatus>();
+    for (auto i = m_fliers.Size(); i-- > 0u;) {
+        const auto& motion = motions[i];
+        const auto left = motion.position.x - GameConstants::flier_visible_radius;
+        const auto right = motion.position.x + GameConstants::flier_visible_radius;
+        const auto gone = 0.0f < motion.velocityX ? bounds.maxs.x < left : right < bounds.mins.x;
+        if (gone) {
+            --m_counts[static_cast<std::size_t>(statuses[i].kind)];
+            m_fliers.DestroyAt(i);
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+void FlierPool::Clear() noexcept {
+    m_fliers.Clear();
+    m_counts.fill(0u);
+    m_firingPositions.clear();
+}
+
+const std::vector<Vector2>& FlierPool::GetFiringPositions() const noexcept {
+    return m_firingPositions;
+}
+
+std::size_t FlierPool::Size() const noexcept {
+    return m_fliers.Size();
+}
+
+bool FlierPool::Empty() const noexcept {
+    return m_fliers.Empty();
+}
+
+std::size_t FlierPool::Count(FlierKind kind) const noexcept {
+    return m_counts[static_cast<std::size_t>(kind)];
+}
+
+FlierKind FlierPool::GetKind(std::size_t idx) const noexcept {
+    return m_fliers.Column<FlierStatus>()[idx].kind;
+}
+
+Disc2 FlierPool::GetCollisionMesh(std::size_t idx) const noexcept {
+    const auto& motion = m_fliers.Column<FlierMotion>()[idx];
+    return Disc2{motion.position, motion.radius};
+}
+
+void FlierPool::Kill(std::size_t idx) noexcept {
+    m_fliers.Column<FlierStatus>()[idx].health = 0;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Disc2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+
+#include "Game/EntityRegistry.hpp"
+#include "Game/GameCommon.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+class GameStateMain;
+struct RenderSnapshot;
+
+enum class FlierKind : std::uint8_t {
+    Bomber
+    , Satellite
+    , Max
+};
+
+struct FlierMotion {
+    Vector2 position{};
+    float velocityX{};
+    float radius{};
+};
+
+struct FlierWeapon {
+    TimeUtils::FPSeconds timeToFire{};
+    TimeUtils::FPSeconds fireRate{};
+};
+
+struct FlierStatus {
+    int health{1};
+    FlierKind kind{FlierKind::Bomber};
+};
+
+using FlierArchetype = Archetype<FlierMotion, FlierWeapon, FlierStatus>;
+
+//Fixed-capacity storage for every bomber and satellite in a wave. Storage is reserved once and reused across waves.
+class FlierPool {
+public:
+    FlierPool() = default;
+    explicit FlierPool(GameStateMain* world) noexcept;
+    FlierPool(const FlierPool& other) = default;
+    FlierPool(FlierPool&& other) = default;
+    FlierPool& operator=(const FlierPool& other) = default;
+    FlierPool& operator=(FlierPool&& other) = default;
+    ~FlierPool() = default;
+
+    //Moves every flier and collects the positions of the ones whose fire timer expired this frame.
+    void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot, Rgba objectColor) const noexcept;
+    void DebugRender() const noexcept;
+    void EndFrame() noexcept;
+
+    bool Spawn(FlierKind kind, Vector2 position, TimeUtils::FPSeconds fireRate) noexcept;
+    //Removes fliers that have fully left bounds in their direction of travel. Returns how many were removed.
+    std::size_t RemoveOffscreen(const AABB2& bounds) noexcept;
+    void Clear() noexcept;
+
+    const std::vector<Vector2>& GetFiringPositions() const noexcept;
+
+    std::size_t Size() const noexcept;
+    bool Empty() const noexcept;
+    std::size_t Count(FlierKind kind) const noexcept;
+
+    FlierKind GetKind(std::size_t idx) const noexcept;
+    Disc2 GetCollisionMesh(std::size_t idx) const noexcept;
+    void Kill(std::size_t idx) noexcept;
+
+protected:
+private:
+    GameStateMain* m_world{nullptr};
+    FlierArchetype m_fliers{};
+    std::array<std::size_t, static_cast<std::size_t>(FlierKind::Max)> m_counts{};
+    std::vector<Vector2> m_firingPositions{};
+};
@@ -0,0 +1,115 @@
+#include "Game/FrameCapture.hpp"
+
+#include "Game/PngFile.hpp"
+
+#include <algorithm>
+#include <format>
+#include <system_error>
+
+FrameCapture::~FrameCapture() noexcept {
+    Stop();
+}
+
+bool FrameCapture::Start(const std::filesystem::path& folder, std::size_t encoderCount, std::size_t slotCount) noexcept {
+    Stop();
+    auto ec = std::error_code{};
+    std::filesystem::create_directories(folder, ec);
+    if (ec) {
+        return false;
+    }
+    m_folder = folder;
+    m_slots = std::vector<Frame>((std::max)(std::size_t{1u}, slotCount));
+    m_freeSlots.clear();
+    for (std::size_t i = 0u; i < m_slots.size(); ++i) {
+        m_freeSlots.push_back(i);
+    }
+    m_queuedSlots.clear();
+    m_nextIndex = 0u;
+    m_written = 0u;
+    m_dropped = 0u;
+    m_failed = 0u;
+    encoderCount = (std::max)(std::size_t{1u}, encoderCount);
+    m_encoders.reserve(encoderCount);
+    for (std::size_t i = 0u; i < encoderCount; ++i) {
+        m_encoders.emplace_back([this](std::stop_token stopToken) { this->EncoderLoop(stopToken); });
+    }
+    return true;
+}
+
+void FrameCapture::Stop() noexcept {
+    for (auto& encoder : m_encoders) {
+        encoder.request_stop();
+    }
+    m_encoders.clear();
+}
+
+bool FrameCapture::IsRunning() const noexcept {
+    return !m_encoders.empty();
+}
+
+bool FrameCapture::Submit(const std::vector<std::uint32_t>& pixels, int width, int height) noexcept {
+    auto slot = std::size_t{0u};
+    auto index = std::uint64_t{0u};
+    {
+        std::scoped_lock lock(m_mutex);
+        //A dropped frame still uses its number, so the drop shows up as a gap in the written sequence.
+        index = m_nextIndex++;
+        if (m_freeSlots.empty()) {
+            ++m_dropped;
+            return false;
+        }
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    //The slot is owned by this thread until it is queued, so the copy happens outside the lock.
+    auto& frame = m_slots[slot];
+    frame.pixels.assign(pixels.begin(), pixels.end());
+    frame.width = width;
+    frame.height = height;
+    frame.index = index;
+    {
+        std::scoped_lock lock(m_mutex);
+        m_queuedSlots.push_back(slot);
+    }
+    m_queued.notify_one();
+    return true;
+}
+
+std::uint64_t FrameCapture::GetWrittenCount() const noexcept {
+    return m_written.load(std::memory_order_relaxed);
+}
+
+std::uint64_t FrameCapture::GetDroppedCount() const noexcept {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+std::uint64_t FrameCapture::GetFailedCount() const noexcept {
+    return m_failed.load(std::memory_order_relaxed);
+}
+
+void FrameCapture::EncoderLoop(std::stop_token stopToken) noexcept {
+    auto scratch = PngFile::Scratch{};
+    for (;;) {
+        auto slot = std::size_t{0u};
+        {
+            std::unique_lock lock(m_mutex);
+            m_queued.wait(lock, stopToken, [this]() { return !m_queuedSlots.empty(); });
+            //A stop request still drains whatever was queued before it.
+            if (m_queuedSlots.empty()) {
+                return;
+            }
+            slot = m_queuedSlots.front();
+            m_queuedSlots.pop_front();
+        }
+        const auto& frame = m_slots[slot];
+        if (PngFile::Write(m_folder / std::format("frame_{:06}.png", frame.index), frame.pixels, frame.width, frame.height, scratch)) {
+            ++m_written;
+        } else {
+            ++m_failed;
+        }
+        {
+            std::scoped_lock lock(m_mutex);
+            m_freeSlots.push_back(slot);
+        }
+    }
+}
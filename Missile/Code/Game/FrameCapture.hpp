@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+//Writes submitted frames as a numbered PNG sequence on background encoder threads.
+//Frames are copied into a fixed set of slots; when every slot is queued or being encoded the frame is dropped
+//instead of blocking the caller. Every submitted frame is numbered, so dropped frames show up as gaps in the sequence.
+class FrameCapture {
+public:
+    FrameCapture() = default;
+    FrameCapture(const FrameCapture& other) = delete;
+    FrameCapture(FrameCapture&& other) = delete;
+    FrameCapture& operator=(const FrameCapture& other) = delete;
+    FrameCapture& operator=(FrameCapture&& other) = delete;
+    ~FrameCapture() noexcept;
+
+    //Returns false if the output folder cannot be created.
+    bool Start(const std::filesystem::path& folder, std::size_t encoderCount, std::size_t slotCount) noexcept;
+    //Encodes everything already queued, then joins the encoders.
+    void Stop() noexcept;
+    bool IsRunning() const noexcept;
+
+    //pixels are RGBA8 packed with red in the lowest byte, rows top to bottom. Alpha is not written.
+    bool Submit(const std::vector<std::uint32_t>& pixels, int width, int height) noexcept;
+
+    std::uint64_t GetWrittenCount() const noexcept;
+    std::uint64_t GetDroppedCount() const noexcept;
+    std::uint64_t GetFailedCount() const noexcept;
+
+protected:
+private:
+    struct Frame {
+        std::vector<std::uint32_t> pixels{};
+        int width{0};
+        int height{0};
+        std::uint64_t index{0u};
+    };
+
+    void EncoderLoop(std::stop_token stopToken) noexcept;
+
+    std::filesystem::path m_folder{};
+    std::vector<Frame> m_slots{};
+    std::vector<std::size_t> m_freeSlots{};
+    std::deque<std::size_t> m_queuedSlots{};
+    std::mutex m_mutex{};
+    std::condition_variable_any m_queued{};
+    std::vector<std::jthread> m_encoders{};
+    std::uint64_t m_nextIndex{0u};
+    std::atomic<std::uint64_t> m_written{0u};
+    std::atomic<std::uint64_t> m_dropped{0u};
+    std::atomic<std::uint64_t> m_failed{0u};
+};
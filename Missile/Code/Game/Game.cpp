@@ -27,16 +27,28 @@
 
 #include <algorithm>
 #include <format>
+#include <string>
+#include <system_error>
 #include <utility>
 
 void MySettings::SaveToConfig(Config& config) noexcept {
     GameSettings::SaveToConfig(config);
     config.SetValue("uiScale", m_UiScale);
+    config.SetValue("stressMode", m_stressMode);
+    config.SetValue("softwareRaster", m_softwareRaster);
+    config.SetValue("captureRasterFrames", m_captureRasterFrames);
+    config.SetValue("softwareAudio", m_softwareAudio);
+    config.SetValue("autoplay", m_autoplay);
 }
 
 void MySettings::SetToDefault() noexcept {
     GameSettings::SetToDefault();
     m_UiScale = m_defaultUiScale;
+    m_stressMode = m_defaultStressMode;
+    m_softwareRaster = m_defaultSoftwareRaster;
+    m_captureRasterFrames = m_defaultCaptureRasterFrames;
+    m_softwareAudio = m_defaultSoftwareAudio;
+    m_autoplay = m_defaultAutoplay;
 }
 
 float MySettings::GetUiScale() const noexcept {
@@ -51,6 +63,66 @@ float MySettings::DefaultUiScale() const noexcept {
     return m_defaultUiScale;
 }
 
+bool MySettings::IsStressModeEnabled() const noexcept {
+    return m_stressMode;
+}
+
+void MySettings::SetStressMode(bool enabled) noexcept {
+    m_stressMode = enabled;
+}
+
+bool MySettings::DefaultStressMode() const noexcept {
+    return m_defaultStressMode;
+}
+
+bool MySettings::IsSoftwareRasterEnabled() const noexcept {
+    return m_softwareRaster;
+}
+
+void MySettings::SetSoftwareRaster(bool enabled) noexcept {
+    m_softwareRaster = enabled;
+}
+
+bool MySettings::DefaultSoftwareRaster() const noexcept {
+    return m_defaultSoftwareRaster;
+}
+
+bool MySettings::IsCaptureRasterFramesEnabled() const noexcept {
+    return m_captureRasterFrames;
+}
+
+void MySettings::SetCaptureRasterFrames(bool enabled) noexcept {
+    m_captureRasterFrames = enabled;
+}
+
+bool MySettings::DefaultCaptureRasterFrames() const noexcept {
+    return m_defaultCaptureRasterFrames;
+}
+
+bool MySettings::IsSoftwareAudioEnabled() const noexcept {
+    return m_softwareAudio;
+}
+
+void MySettings::SetSoftwareAudio(bool enabled) noexcept {
+    m_softwareAudio = enabled;
+}
+
+bool MySettings::DefaultSoftwareAudio() const noexcept {
+    return m_defaultSoftwareAudio;
+}
+
+bool MySettings::IsAutoplayEnabled() const noexcept {
+    return m_autoplay;
+}
+
+void MySettings::SetAutoplay(bool enabled) noexcept {
+    m_autoplay = enabled;
+}
+
+bool MySettings::DefaultAutoplay() const noexcept {
+    return m_defaultAutoplay;
+}
+
 void Game::LoadOrCreateConfigFile() noexcept {
     if (!g_theConfig->AppendFromFile(GameConstants::game_config_path)) {
         if (g_theConfig->HasKey("uiScale")) {
@@ -64,6 +136,70 @@ void Game::LoadOrCreateConfigFile() noexcept {
             g_theFileLogger->LogWarnLine("Could not save game config.");
         }
     }
+    if (g_theConfig->HasKey("stressMode")) {
+        bool value = m_mySettings.IsStressModeEnabled();
+        g_theConfig->GetValueOr("stressMode", value, m_mySettings.DefaultStressMode());
+        m_mySettings.SetStressMode(value);
+    }
+    if (g_theConfig->HasKey("softwareRaster")) {
+        bool value = m_mySettings.IsSoftwareRasterEnabled();
+        g_theConfig->GetValueOr("softwareRaster", value, m_mySettings.DefaultSoftwareRaster());
+        m_mySettings.SetSoftwareRaster(value);
+    }
+    if (g_theConfig->HasKey("captureRasterFrames")) {
+        bool value = m_mySettings.IsCaptureRasterFramesEnabled();
+        g_theConfig->GetValueOr("captureRasterFrames", value, m_mySettings.DefaultCaptureRasterFrames());
+        m_mySettings.SetCaptureRasterFrames(value);
+    }
+    if (g_theConfig->HasKey("softwareAudio")) {
+        bool value = m_mySettings.IsSoftwareAudioEnabled();
+        g_theConfig->GetValueOr("softwareAudio", value, m_mySettings.DefaultSoftwareAudio());
+        m_mySettings.SetSoftwareAudio(value);
+    }
+    if (g_theConfig->HasKey("autoplay")) {
+        bool value = m_mySettings.IsAutoplayEnabled();
+        g_theConfig->GetValueOr("autoplay", value, m_mySettings.DefaultAutoplay());
+        m_mySettings.SetAutoplay(value);
+    }
+}
+
+void Game::LoadSoundBank() noexcept {
+    if (SoundBank::IsStale(GameConstants::game_audio_folder, GameConstants::game_sound_bank_path)) {
+        if (!SoundBank::Build(GameConstants::game_audio_folder, GameConstants::game_sound_bank_path)) {
+            g_theFileLogger->LogWarnLine("Could not build the sound bank.");
+        }
+    }
+    if (!m_soundBank.Open(GameConstants::game_sound_bank_path)) {
+        g_theFileLogger->LogWarnLine("Could not open the sound bank; sound lengths will be read from the wav files.");
+    }
+}
+
+bool Game::LoadWaveTable() noexcept {
+    auto ec = std::error_code{};
+    auto definitions_time = std::filesystem::last_write_time(GameConstants::game_wave_definitions_path, ec);
+    if (ec) {
+        definitions_time = std::filesystem::file_time_type::min();
+    }
+    if (m_waveDefinitionsTime == definitions_time) {
+        return false;
+    }
+    //At startup the compiled table is trusted unless it is older than the definitions.
+    //After that any change is recompiled, even to an older time, so reverting a file to an older copy also reloads.
+    const auto is_changed = m_waveDefinitionsTime.has_value();
+    m_waveDefinitionsTime = definitions_time;
+    if (is_changed || WaveTable::IsStale(GameConstants::game_wave_definitions_path, GameConstants::game_wave_table_path)) {
+        m_waveTable.Close();
+        auto error = std::string{};
+        if (WaveTable::Compile(GameConstants::game_wave_definitions_path, GameConstants::game_wave_table_path, error)) {
+            g_theFileLogger->LogLine("Compiled wave definitions.");
+        } else {
+            g_theFileLogger->LogWarnLine(std::format("Could not compile wave definitions: {}", error));
+        }
+    }
+    if (!m_waveTable.IsOpen() && !m_waveTable.Open(GameConstants::game_wave_table_path)) {
+        g_theFileLogger->LogWarnLine("Could not open the wave table; every wave will use the built-in fallback.");
+    }
+    return true;
 }
 
 void Game::ChangeState(std::unique_ptr<GameState> newState) noexcept {
@@ -75,12 +211,28 @@ void Game::Initialize() noexcept {
     g_theRenderer->SetVSync(true);
     g_theRenderer->RegisterMaterialsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameMaterials));
     g_theRenderer->RegisterFontsFromFolder(FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameFonts));
+    LoadWaveTable();
+    LoadSoundBank();
+    //Sounds play from the mapped bank through the software mixer; the engine only loads the wav files if that cannot start.
+    if (m_mySettings.IsSoftwareAudioEnabled()) {
+        if (!m_soundBank.IsOpen()) {
+            g_theFileLogger->LogWarnLine("No sound bank; sounds will play through the engine.");
+        } else if (!m_waveOutDevice.Start(m_softwareMixer)) {
+            g_theFileLogger->LogWarnLine("Could not open the wave output device; sounds will play through the engine.");
+        }
+    }
+    m_soundBoard.Load(m_soundBank, m_waveOutDevice.IsRunning() ? &m_softwareMixer : nullptr);
 
     ChangeState(std::move(std::make_unique<GameStateMain>()));
 
 }
 
 void Game::BeginFrame() noexcept {
+    if (m_waveDefinitionsPoll.CheckAndReset() && LoadWaveTable()) {
+        if (auto* main_state = dynamic_cast<GameStateMain*>(this->GetCurrentState()); main_state != nullptr) {
+            main_state->ReloadWaveParams();
+        }
+    }
     if(m_nextState) {
         m_currentState->OnExit();
         m_currentState = std::move(m_nextState);
@@ -138,6 +290,30 @@ GameState* const Game::GetCurrentState() const noexcept {
     return m_currentState.get();
 }
 
+WorkerPool& Game::GetWorkerPool() noexcept {
+    return m_workerPool;
+}
+
+const SoundBank& Game::GetSoundBank() const noexcept {
+    return m_soundBank;
+}
+
+SoundBoard& Game::GetSoundBoard() noexcept {
+    return m_soundBoard;
+}
+
+const SoftwareMixer& Game::GetSoftwareMixer() const noexcept {
+    return m_softwareMixer;
+}
+
+const WaveOutDevice& Game::GetWaveOutDevice() const noexcept {
+    return m_waveOutDevice;
+}
+
+const WaveTable& Game::GetWaveTable() const noexcept {
+    return m_waveTable;
+}
+
 const GameSettings* Game::GetSettings() const noexcept {
     return &m_mySettings;
 }
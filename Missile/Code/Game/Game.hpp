@@ -4,6 +4,7 @@
 
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Core/OrthographicCameraController.hpp"
+#include "Engine/Core/Stopwatch.hpp"
 
 #include "Engine/Math/AABB2.hpp"
 
@@ -17,6 +18,12 @@
 #include "Game/EnemyWave.hpp"
 #include "Game/City.hpp"
 #include "Game/CityManager.hpp"
+#include "Game/SoftwareMixer.hpp"
+#include "Game/SoundBank.hpp"
+#include "Game/SoundBoard.hpp"
+#include "Game/WaveOutDevice.hpp"
+#include "Game/WaveTable.hpp"
+#include "Game/WorkerPool.hpp"
 
 #include "Game/GameState.hpp"
 #include "Game/GameStateTitle.hpp"
@@ -25,6 +32,8 @@
 
 #include <array>
 #include <cstdint>
+#include <filesystem>
+#include <optional>
 #include <vector>
 
 class MySettings : public GameSettings {
@@ -36,9 +45,39 @@ public:
     virtual void SetUiScale(float newScale) noexcept;
     virtual float DefaultUiScale() const noexcept;
 
+    virtual bool IsStressModeEnabled() const noexcept;
+    virtual void SetStressMode(bool enabled) noexcept;
+    virtual bool DefaultStressMode() const noexcept;
+
+    virtual bool IsSoftwareRasterEnabled() const noexcept;
+    virtual void SetSoftwareRaster(bool enabled) noexcept;
+    virtual bool DefaultSoftwareRaster() const noexcept;
+
+    virtual bool IsCaptureRasterFramesEnabled() const noexcept;
+    virtual void SetCaptureRasterFrames(bool enabled) noexcept;
+    virtual bool DefaultCaptureRasterFrames() const noexcept;
+
+    virtual bool IsSoftwareAudioEnabled() const noexcept;
+    virtual void SetSoftwareAudio(bool enabled) noexcept;
+    virtual bool DefaultSoftwareAudio() const noexcept;
+
+    virtual bool IsAutoplayEnabled() const noexcept;
+    virtual void SetAutoplay(bool enabled) noexcept;
+    virtual bool DefaultAutoplay() const noexcept;
+
 protected:
     float m_UiScale{1.0f};
     float m_defaultUiScale{1.0f};
+    bool m_stressMode{false};
+    bool m_defaultStressMode{false};
+    bool m_softwareRaster{false};
+    bool m_defaultSoftwareRaster{false};
+    bool m_captureRasterFrames{false};
+    bool m_defaultCaptureRasterFrames{false};
+    bool m_softwareAudio{true};
+    bool m_defaultSoftwareAudio{true};
+    bool m_autoplay{false};
+    bool m_defaultAutoplay{false};
 };
 
 struct Player {
@@ -76,14 +115,33 @@ public:
 
     GameState* const GetCurrentState() const noexcept;
 
+    WorkerPool& GetWorkerPool() noexcept;
+    const SoundBank& GetSoundBank() const noexcept;
+    SoundBoard& GetSoundBoard() noexcept;
+    const SoftwareMixer& GetSoftwareMixer() const noexcept;
+    const WaveOutDevice& GetWaveOutDevice() const noexcept;
+    const WaveTable& GetWaveTable() const noexcept;
+
 protected:
 private:
 
     void LoadOrCreateConfigFile() noexcept;
+    void LoadSoundBank() noexcept;
+    //Recompiles and reopens the wave table if the definitions changed since the last call. Returns true if it did.
+    bool LoadWaveTable() noexcept;
 
     int m_currentHighScore{ GameConstants::default_highscore };
     MySettings m_mySettings{};
     std::unique_ptr<GameState> m_currentState{std::make_unique<GameStateTitle>()};
     std::unique_ptr<GameState> m_nextState{};
     Player m_playerData{};
+    WorkerPool m_workerPool{};
+    WaveTable m_waveTable{};
+    std::optional<std::filesystem::file_time_type> m_waveDefinitionsTime{};
+    Stopwatch m_waveDefinitionsPoll{TimeUtils::FPSeconds{GameConstants::wave_definitions_poll_seconds}};
+    //Declared in dependency order so the mix thread is joined before the mixer and bank it reads are destroyed.
+    SoundBank m_soundBank{};
+    SoftwareMixer m_softwareMixer{GameConstants::software_mixer_output_rate};
+    WaveOutDevice m_waveOutDevice{};
+    SoundBoard m_soundBoard{};
 };
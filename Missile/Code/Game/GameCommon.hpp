@@ -20,9 +20,11 @@ namespace GameConstants {
     constexpr const int max_score_multiplier{6};
     constexpr const int max_enemy_missile_count{20};
     constexpr const int max_player_missile_count{30};
+    constexpr const int max_base_missile_count{10};
     constexpr const int max_smartbomb_count{7};
     constexpr const int max_missles_on_screen{4};
     constexpr const int max_cities{6};
+    constexpr const int low_missile_count{4};
     constexpr const float min_missile_impact_time{2.0f};
     constexpr const float min_missile_speed{0.0f};
     constexpr const float min_bomber_cooldown{32.0f};
@@ -36,25 +38,53 @@ namespace GameConstants {
     constexpr const int saved_city_value{100};
     constexpr const int default_highscore{17000};
     constexpr const int default_bonus_city_score{10000};
-    constexpr const std::size_t wave_array_size{20u};
-    constexpr std::array<int, wave_array_size> wave_score_multiplier_lookup{ 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6 };
-    constexpr std::array<int, wave_array_size> wave_missile_count_lookup{ 12, 15, 18, 12, 16, 14, 17, 10, 13, 16, 19, 12, 14, 16, 18, 14, 16, 18, 20, 20 };
-    constexpr std::array<int, wave_array_size> wave_smartbomb_count_lookup{ 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 4, 5, 5, 6, 6, 7, 7, 7, 7, 7 };
-    constexpr std::array<float, wave_array_size> wave_missile_impact_time{12.0f, 11.0f, 10.0f, 9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f };
-    constexpr const std::array wave_flier_cooldown_lookup{36000.0f, 240.0f, 160.0f, 128.0f, 128.0f, 96.0f, 64.0f, 32.0f};
-    constexpr const std::array wave_flier_firerate_lookup{36000.0f, 128.0f, 96.0f, 64.0f, 48.0f, 32.0f, 32.0f, 16.0f};
-    constexpr const std::array<uint32_t, wave_array_size> wave_object_color_lookup{ uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0xff00ffu}, uint32_t{0xff00ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu} };
-    constexpr const std::array<uint32_t, wave_array_size> wave_player_color_lookup{ uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu} };
-    constexpr const std::array<uint32_t, wave_array_size> wave_background_color_lookup{ uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x000000ffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0x00ffffffu}, uint32_t{0x00ffffffu}, uint32_t{0xff00ffffu}, uint32_t{0xff00ffffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xc0c0c0ffu}, uint32_t{0xc0c0c0ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu} };
-    constexpr const std::array<uint32_t, wave_array_size> wave_ground_color_lookup{ uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0x0000ffffu}, uint32_t{0x0000ffffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0x00ff00ffu}, uint32_t{0xff0000ffu}, uint32_t{0xff0000ffu}, uint32_t{0xffff00ffu}, uint32_t{0xffff00ffu} };
     constexpr const float radar_line_distance{100.0f};
+    constexpr const float target_weight_city{3.0f};
+    constexpr const float target_weight_base{1.0f};
+    //How long after a player explosion starts an intercepted missile should reach its center.
+    constexpr const float intercept_detonation_lead_seconds{0.1f};
+    constexpr const float autoplay_fire_interval_seconds{0.1f};
+    constexpr const float autoplay_retry_seconds{0.5f};
+    constexpr const float autoplay_cover_radius{max_explosion_size * 0.5f};
+    constexpr const float autoplay_report_seconds{60.0f};
+    constexpr const float autoplay_stall_seconds{300.0f};
+    constexpr const std::size_t parallel_collision_min_missiles{2048u};
+    constexpr const std::size_t parallel_collision_grain_size{1024u};
+    constexpr const std::size_t flier_pool_capacity{64u};
+    constexpr const std::size_t max_fliers_per_kind{1u};
+    constexpr const std::size_t stress_max_fliers_per_kind{32u};
+    constexpr const float bomber_speed{20.0f};
+    constexpr const float bomber_radius{15.0f};
+    constexpr const float satellite_speed{30.0f};
+    constexpr const float satellite_radius{25.0f};
+    constexpr const float flier_visible_radius{50.0f};
+    constexpr const float circle_lod_max_error_pixels{0.5f};
+    constexpr const std::size_t event_ring_capacity{4096u};
+    constexpr const std::size_t frame_capture_slot_count{8u};
+    constexpr const std::size_t frame_capture_encoder_count{2u};
+    constexpr const std::size_t render_stats_history_frames{600u};
+    constexpr const std::size_t sound_command_capacity{256u};
+    constexpr const float sound_max_merged_volume{2.0f};
+    constexpr const float sound_fallback_length_seconds{2.0f};
+    constexpr const std::uint32_t software_mixer_output_rate{48000u};
+    constexpr const std::size_t mixer_benchmark_block_count{6000u};
+    constexpr const std::size_t mixer_benchmark_uncapped_scale{16u};
+    constexpr const float mixer_benchmark_frame_seconds{1.0f / 60.0f};
+    constexpr const float mixer_benchmark_paced_seconds{5.0f};
+    constexpr const int raster_benchmark_width{1600};
+    constexpr const int raster_benchmark_height{900};
+    constexpr const std::size_t raster_benchmark_frame_count{300u};
+    constexpr const std::size_t raster_benchmark_explosion_count{256u};
+    constexpr const std::size_t raster_benchmark_trail_count{512u};
+    //Share of pixels allowed to differ from a golden image, for edge pixels that round differently between compilers.
+    constexpr const float raster_golden_max_mismatch_fraction{0.002f};
+    constexpr const float wave_definitions_poll_seconds{0.5f};
     const std::filesystem::path game_config_path{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameConfig) / std::filesystem::path{"game.config"}};
     const std::filesystem::path game_audio_folder{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "Audio" }};
-    const std::filesystem::path game_audio_klaxon_path{game_audio_folder / std::filesystem::path{"Klaxon.wav"}};
-    const std::filesystem::path game_audio_bomber_path{game_audio_folder / std::filesystem::path{"Bomber.wav"}};
-    const std::filesystem::path game_audio_satellite_path{game_audio_folder / std::filesystem::path{"Satellite.wav"}};
-    const std::filesystem::path game_audio_nomissiles_path{game_audio_folder / std::filesystem::path{"NoMissiles.wav"}};
-    const std::filesystem::path game_audio_lowmissiles_path{game_audio_folder / std::filesystem::path{"LowMissiles.wav"}};
-    const std::filesystem::path game_audio_counting_path{game_audio_folder / std::filesystem::path{"Counting.wav"}};
-    const std::filesystem::path game_audio_bonuscity_path{game_audio_folder / std::filesystem::path{"BonusCity.wav"}};
+    const std::filesystem::path game_wave_definitions_path{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "Definitions" } / std::filesystem::path{ "Waves.csv" }};
+    const std::filesystem::path game_wave_table_path{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "Waves.table" }};
+    const std::filesystem::path game_sound_bank_path{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "Audio.bank" }};
+    const std::filesystem::path game_raster_capture_folder{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "RasterCaptures" }};
+    const std::filesystem::path game_raster_golden_folder{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "Golden" } / std::filesystem::path{ "Raster" }};
+    const std::filesystem::path game_render_stats_path{FileUtils::GetKnownFolderPath(FileUtils::KnownPathID::GameData) / std::filesystem::path{ "RenderStats.csv" }};
 };
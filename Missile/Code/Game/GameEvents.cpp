@@ -0,0 +1,13 @@
+#include "Game/GameEvents.hpp"
+
+void GameEventBus::Publish(const GameEvent& event) noexcept {
+    for (auto& ring : m_channels) {
+        if (!ring.TryPush(event)) {
+            m_dropped.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::uint64_t GameEventBus::GetDroppedCount() const noexcept {
+    return m_dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+
+#include "Game/EventRing.hpp"
+#include "Game/GameCommon.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+enum class GameEventType : std::uint8_t {
+    MissileLaunched
+    , Explosion
+    , FlierSpawned
+    , EnemyKilled
+    , CityLost
+    , WaveChanged
+    , ScoreTallied
+    , BonusCity
+    , LowMissiles
+    , OutOfMissiles
+    , Max
+};
+
+//value holds the points awarded for EnemyKilled/ScoreTallied, the new wave id for WaveChanged and the FlierKind for FlierSpawned.
+struct GameEvent {
+    GameEventType type{GameEventType::Max};
+    Faction faction{Faction::None};
+    Vector2 position{};
+    int value{0};
+};
+
+enum class GameEventChannel : std::uint8_t {
+    Audio
+    , UI
+    , Metrics
+    , Max
+};
+
+//Every published event is copied into one ring per channel so each consumer drains at its own pace.
+class GameEventBus {
+public:
+    GameEventBus() = default;
+    GameEventBus(const GameEventBus& other) = delete;
+    GameEventBus(GameEventBus&& other) = delete;
+    GameEventBus& operator=(const GameEventBus& other) = delete;
+    GameEventBus& operator=(GameEventBus&& other) = delete;
+    ~GameEventBus() = default;
+
+    //Safe to call from simulation workers. Events that do not fit are dropped and counted.
+    void Publish(const GameEvent& event) noexcept;
+
+    template<typename Fn>
+    void Drain(GameEventChannel channel, Fn&& fn) noexcept {
+        auto& ring = m_channels[static_cast<std::size_t>(channel)];
+        auto event = GameEvent{};
+        while (ring.TryPop(event)) {
+            fn(event);
+        }
+    }
+
+    std::uint64_t GetDroppedCount() const noexcept;
+
+protected:
+private:
+    using Ring = EventRing<GameEvent, GameConstants::event_ring_capacity>;
+
+    std::array<Ring, static_cast<std::size_t>(GameEventChannel::Max)> m_channels{};
+    std::atomic<std::uint64_t> m_dropped{0u};
+};
@@ -26,11 +26,57 @@
 #include "Game/EnemyWaveStateActive.hpp"
 #include "Game/EnemyWaveStatePostwave.hpp"
 
+#include <algorithm>
 #include <format>
 
+namespace FrameResource {
+    constexpr const TaskGraph::ResourceMask None{0u};
+    constexpr const TaskGraph::ResourceMask Layout{1u << 0};
+    constexpr const TaskGraph::ResourceMask Waves{1u << 1};
+    constexpr const TaskGraph::ResourceMask BaseLeft{1u << 2};
+    constexpr const TaskGraph::ResourceMask BaseCenter{1u << 3};
+    constexpr const TaskGraph::ResourceMask BaseRight{1u << 4};
+    constexpr const TaskGraph::ResourceMask Bases{BaseLeft | BaseCenter | BaseRight};
+    constexpr const TaskGraph::ResourceMask Explosions{1u << 5};
+    constexpr const TaskGraph::ResourceMask Cities{1u << 6};
+    constexpr const TaskGraph::ResourceMask Score{1u << 7};
+    constexpr const TaskGraph::ResourceMask Random{1u << 8};
+    constexpr const TaskGraph::ResourceMask UI{1u << 9};
+}
+
 void GameStateMain::OnEnter() noexcept {
 
+    m_renderHandles.Resolve();
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        if (const auto* settings = dynamic_cast<const MySettings*>(g->GetSettings()); settings != nullptr) {
+            m_stressMode = settings->IsStressModeEnabled();
+            m_uiScale = settings->GetUiScale();
+            m_softwareRaster = settings->IsSoftwareRasterEnabled();
+            m_captureRasterFrames = settings->IsCaptureRasterFramesEnabled();
+            m_autoplay = settings->IsAutoplayEnabled();
+        }
+    }
+
     auto dims = Vector2{ g_theRenderer->GetOutput()->GetDimensions() };
+    //This records the software rasterizer's framebuffer, a flat-shaded approximation of the GPU frame, not the back buffer.
+    if (m_captureRasterFrames) {
+        m_softwareRaster = true;
+    }
+    if (m_softwareRaster) {
+        m_softwareRasterizer.Resize(static_cast<int>(dims.x), static_cast<int>(dims.y));
+        m_softwareRasterTime = TimeUtils::FPSeconds::zero();
+        m_softwareRasterFrames = 0u;
+        m_softwareRasterWaits = 0u;
+        m_softwareRasterWaitTime = TimeUtils::FPSeconds::zero();
+        m_softwareRasterQueuedCount = 0u;
+        m_softwareRasterDoneCount = 0u;
+        m_softwareRasterThread = std::jthread([this](std::stop_token stopToken) { this->SoftwareRasterLoop(stopToken); });
+    }
+    if (m_captureRasterFrames && !m_frameCapture.Start(GameConstants::game_raster_capture_folder, GameConstants::frame_capture_encoder_count, GameConstants::frame_capture_slot_count)) {
+        g_theFileLogger->LogWarnLine(std::format("Could not create raster capture folder {}.", GameConstants::game_raster_capture_folder.string()));
+    }
+    m_renderStats.Reset();
+    m_autoplayBot.Reset();
     m_world_bounds.ScalePadding(dims.x, dims.y);
     m_world_bounds.Translate(-m_world_bounds.CalcCenter());
 
@@ -78,20 +124,76 @@ void GameStateMain::OnEnter() noexcept {
     auto desc = AudioSystem::SoundDesc{};
     desc.loopCount = 6;
     desc.stopWhenFinishedLooping = true;
-    g_theAudioSystem->Play(GameConstants::game_audio_klaxon_path, desc);
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        g->GetSoundBoard().Request(SoundId::Klaxon, desc);
+        g->GetSoundBoard().Flush();
+    }
+
+    BuildFrameGraphs();
+    m_hudDirty = true;
+    RefreshHud();
+    CaptureRenderSnapshot();
+}
+
+void GameStateMain::BuildFrameGraphs() noexcept {
+    namespace FR = FrameResource;
+
+    //Declared access must cover everything a phase touches, including the engine RNG (Rgba::Random, MathUtils::GetRandom*)
+    //and explosions spawned by dying objects. Side effects such as audio go through the event bus, which any node may publish to.
+    m_beginFrameGraph.Clear();
+    m_beginFrameGraph.AddNode("Waves.BeginFrame", FR::Layout, FR::Waves | FR::Bases | FR::Cities | FR::Score | FR::Random | FR::UI, [this]() { m_waves.BeginFrame(); });
+    m_beginFrameGraph.AddNode("BaseLeft.BeginFrame", FR::None, FR::BaseLeft, [this]() { m_missileBaseLeft.BeginFrame(); });
+    m_beginFrameGraph.AddNode("BaseCenter.BeginFrame", FR::None, FR::BaseCenter, [this]() { m_missileBaseCenter.BeginFrame(); });
+    m_beginFrameGraph.AddNode("BaseRight.BeginFrame", FR::None, FR::BaseRight, [this]() { m_missileBaseRight.BeginFrame(); });
+    m_beginFrameGraph.AddNode("Explosions.BeginFrame", FR::None, FR::Explosions | FR::Random, [this]() { m_explosionManager.BeginFrame(); });
+    m_beginFrameGraph.AddNode("Cities.BeginFrame", FR::None, FR::Cities, [this]() { m_cityManager.BeginFrame(); });
+
+    m_updateGraph.Clear();
+    m_updateGraph.AddNode("Waves.Update", FR::Layout | FR::Bases | FR::Cities, FR::Waves | FR::Random, [this]() { m_waves.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("BaseLeft.Update", FR::None, FR::BaseLeft, [this]() { m_missileBaseLeft.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("BaseCenter.Update", FR::None, FR::BaseCenter, [this]() { m_missileBaseCenter.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("BaseRight.Update", FR::None, FR::BaseRight, [this]() { m_missileBaseRight.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("Explosions.Update", FR::None, FR::Explosions, [this]() { m_explosionManager.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("Collide.Missiles", FR::Explosions, FR::Waves | FR::Score | FR::Cities, [this]() { HandleMissileExplosionCollisions(m_waves.GetMissileManager()); });
+    m_updateGraph.AddNode("Collide.Fliers", FR::Explosions, FR::Waves | FR::Score | FR::Cities, [this]() { HandleFlierExplosionCollisions(); });
+    m_updateGraph.AddNode("Collide.Cities", FR::Explosions, FR::Cities, [this]() { HandleCityExplosionCollisions(); });
+    m_updateGraph.AddNode("Collide.Bases", FR::Explosions, FR::Bases, [this]() { HandleBaseExplosionCollisions(); });
+    m_updateGraph.AddNode("Collide.Ground", FR::Layout, FR::Waves, [this]() { HandleMissileGroundCollisions(m_waves.GetMissileManager()); });
+    m_updateGraph.AddNode("Cities.Update", FR::None, FR::Cities, [this]() { m_cityManager.Update(m_frameDeltaSeconds); });
+    m_updateGraph.AddNode("HighScore", FR::None, FR::Score, [this]() { UpdateHighScore(); });
+
+    m_endFrameGraph.Clear();
+    m_endFrameGraph.AddNode("BaseLeft.EndFrame", FR::None, FR::BaseLeft | FR::Explosions | FR::Random, [this]() { m_missileBaseLeft.EndFrame(); });
+    m_endFrameGraph.AddNode("BaseCenter.EndFrame", FR::None, FR::BaseCenter | FR::Explosions | FR::Random, [this]() { m_missileBaseCenter.EndFrame(); });
+    m_endFrameGraph.AddNode("BaseRight.EndFrame", FR::None, FR::BaseRight | FR::Explosions | FR::Random, [this]() { m_missileBaseRight.EndFrame(); });
+    m_endFrameGraph.AddNode("Cities.EndFrame", FR::None, FR::Cities, [this]() { m_cityManager.EndFrame(); });
+    m_endFrameGraph.AddNode("Explosions.EndFrame", FR::None, FR::Explosions, [this]() { m_explosionManager.EndFrame(); });
+    m_endFrameGraph.AddNode("Waves.EndFrame", FR::Layout, FR::Waves | FR::Bases | FR::Explosions | FR::Random | FR::UI, [this]() { m_waves.EndFrame(); });
+}
+
+WorkerPool* GameStateMain::GetFrameWorkerPool() const noexcept {
+    if (!IsStressModeEnabled()) {
+        return nullptr;
+    }
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        return &g->GetWorkerPool();
+    }
+    return nullptr;
 }
 
 void GameStateMain::OnExit() noexcept {
-
+    DispatchGameEvents();
+    LogEventTotals();
+    if (m_autoplay) {
+        LogAutoplayReport();
+    }
+    StopSoftwareRaster();
+    LogSoftwareRasterStats();
+    StopFrameCapture();
 }
 
 void GameStateMain::BeginFrame() noexcept {
-    m_waves.BeginFrame();
-    m_missileBaseLeft.BeginFrame();
-    m_missileBaseCenter.BeginFrame();
-    m_missileBaseRight.BeginFrame();
-    m_explosionManager.BeginFrame();
-    m_cityManager.BeginFrame();
+    m_beginFrameGraph.Run(GetFrameWorkerPool());
 }
 
 void GameStateMain::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noexcept {
@@ -102,27 +204,22 @@ void GameStateMain::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) n
 
     m_ui_camera.Update(deltaSeconds);
     m_cameraController.Update(deltaSeconds);
+    if (m_showRenderStats) {
+        ShowRenderStatsWindow();
+    }
 
     CalculateCrosshairLocation();
-    m_waves.Update(deltaSeconds);
-    m_missileBaseLeft.Update(deltaSeconds);
-    m_missileBaseCenter.Update(deltaSeconds);
-    m_missileBaseRight.Update(deltaSeconds);
-    m_explosionManager.Update(deltaSeconds);
-    HandleMissileExplosionCollisions(m_waves.GetMissileManager());
-    HandleBomberExplosionCollision();
-    HandleSatelliteExplosionCollision();
-    HandleCityExplosionCollisions();
-    HandleBaseExplosionCollisions();
-    HandleMissileGroundCollisions(m_waves.GetMissileManager());
-    m_cityManager.Update(deltaSeconds);
-    UpdateHighScore();
+    m_frameDeltaSeconds = deltaSeconds;
+    m_updateGraph.Run(GetFrameWorkerPool());
 }
 
 void GameStateMain::HandlePlayerInput(TimeUtils::FPSeconds deltaSeconds) {
     HandleKeyboardInput(deltaSeconds);
     HandleControllerInput(deltaSeconds);
     HandleMouseInput(deltaSeconds);
+    if (m_autoplay) {
+        HandleAutoplay(deltaSeconds);
+    }
 }
 
 void GameStateMain::HandleKeyboardInput(TimeUtils::FPSeconds /*deltaSeconds*/) {
@@ -165,6 +262,25 @@ void GameStateMain::HandleMouseInput(TimeUtils::FPSeconds /*deltaSeconds*/) {
     }
 }
 
+void GameStateMain::HandleAutoplay(TimeUtils::FPSeconds deltaSeconds) noexcept {
+    if (const auto shot = m_autoplayBot.Update(SolveIntercepts(), GetWaveId(), deltaSeconds); shot.has_value()) {
+        FireFrom(shot->launcher, MissileManager::Target{ shot->target });
+    }
+    if (TimeUtils::FPSeconds{ GameConstants::autoplay_report_seconds } <= m_autoplayBot.GetStats().intervalFrameTime) {
+        LogAutoplayReport();
+        m_autoplayBot.ResetFrameTimes();
+    }
+}
+
+void GameStateMain::FireFrom(std::size_t launcher, MissileManager::Target target) noexcept {
+    switch (launcher) {
+    case 0u: m_missileBaseLeft.Fire(target); break;
+    case 1u: m_missileBaseCenter.Fire(target); break;
+    case 2u: m_missileBaseRight.Fire(target); break;
+    default: break;
+    }
+}
+
 void GameStateMain::CalculateCrosshairLocation() noexcept {
     m_mouse_world_pos = CalcCrosshairPositionFromRawMousePosition();
     ClampCrosshairToRadar();
@@ -206,8 +322,47 @@ Vector2 GameStateMain::CityLocation(std::size_t index) const noexcept {
     return m_cityManager.GetCity(index).GetCollisionMesh().CalcCenter();
 }
 
-const std::array<MissileManager::Target, 9> GameStateMain::GetValidTargets() const noexcept {
-    return std::array<MissileManager::Target, 9>{ BaseLocationLeft(), BaseLocationCenter(), BaseLocationRight(), CityLocation(0), CityLocation(1), CityLocation(2), CityLocation(3), CityLocation(4), CityLocation(5) };
+MissileManager::Target GameStateMain::PickEnemyTarget() noexcept {
+    if (const auto generation = m_targetGeneration.load(std::memory_order_acquire); generation != m_targetTableGeneration) {
+        m_targetTableGeneration = generation;
+        RefreshTargets();
+    }
+    return MissileManager::Target{ m_targets.Pick(MathUtils::GetRandomZeroUpToOne()) };
+}
+
+void GameStateMain::InvalidateTargets() noexcept {
+    m_targetGeneration.fetch_add(1u, std::memory_order_release);
+}
+
+void GameStateMain::RefreshTargets() noexcept {
+    //An empty base has nothing left to destroy, so it drops out of the table the same as a ruined city.
+    const auto base_weight = [](const MissileBase& base) { return base.HasMissilesRemaining() ? GameConstants::target_weight_base : 0.0f; };
+    m_targets.SetPosition(0u, BaseLocationLeft());
+    m_targets.SetWeight(0u, base_weight(m_missileBaseLeft));
+    m_targets.SetPosition(1u, BaseLocationCenter());
+    m_targets.SetWeight(1u, base_weight(m_missileBaseCenter));
+    m_targets.SetPosition(2u, BaseLocationRight());
+    m_targets.SetWeight(2u, base_weight(m_missileBaseRight));
+    for (std::size_t i = 0u; i < static_cast<std::size_t>(GameConstants::max_cities); ++i) {
+        m_targets.SetPosition(3u + i, CityLocation(i));
+        m_targets.SetWeight(3u + i, m_cityManager.GetCity(i).IsAlive() ? GameConstants::target_weight_city : 0.0f);
+    }
+}
+
+const InterceptSolver& GameStateMain::SolveIntercepts() noexcept {
+    m_interceptSolver.ClearThreats();
+    if (const auto* missiles = m_waves.GetMissileManager(); missiles != nullptr) {
+        m_interceptSolver.ReserveThreats(missiles->ActiveMissileCount());
+        missiles->AppendThreats(m_interceptSolver);
+    }
+    const auto launcher = [](const MissileBase& base) { return InterceptSolver::Launcher{ base.GetMissileLauncherPosition(), base.GetTimeToTarget(), base.GetMissilesRemaining() }; };
+    const auto launchers = std::array<InterceptSolver::Launcher, 3>{ launcher(m_missileBaseLeft), launcher(m_missileBaseCenter), launcher(m_missileBaseRight) };
+    //Catches are kept an explosion's width off the ground so they never take a city or base with them,
+    //and out of the radar band the crosshair cannot enter.
+    auto area = m_world_bounds;
+    area.maxs.y = (std::min)(BaseLocationCenter().y - GameConstants::max_explosion_size, m_world_bounds.maxs.y - GameConstants::radar_line_distance);
+    m_interceptSolver.Solve(launchers, area, TimeUtils::FPSeconds{ GameConstants::intercept_detonation_lead_seconds });
+    return m_interceptSolver;
 }
 
 Vector2 GameStateMain::CalcCrosshairPositionFromRawMousePosition() noexcept {
@@ -224,6 +379,7 @@ CityManager& GameStateMain::GetCityManager() noexcept {
 
 void GameStateMain::CreateExplosionAt(Vector2 position, Faction faction) noexcept {
     m_explosionManager.CreateExplosionAt(ExplosionManager::ExplosionData{ Vector4{position, GameConstants::max_explosion_size, 3.0f}, faction });
+    PublishEvent(GameEvent{GameEventType::Explosion, faction, position, 0});
 }
 
 const MissileManager* GameStateMain::GetMissileManager() const noexcept {
@@ -276,6 +432,10 @@ void GameStateMain::HandleMissileExplosionCollisions(MissileManager* missileMana
     if (missileManager == nullptr) {
         return;
     }
+    if (IsStressModeEnabled() && GameConstants::parallel_collision_min_missiles <= missileManager->ActiveMissileCount()) {
+        HandleMissileExplosionCollisionsParallel(missileManager);
+        return;
+    }
     const auto& missiles = missileManager->GetMissilePositions();
     const auto& explosions = m_explosionManager.GetExplosionCollisionMeshes();
     for (const auto& e : explosions) {
@@ -284,39 +444,61 @@ void GameStateMain::HandleMissileExplosionCollisions(MissileManager* missileMana
             if (MathUtils::IsPointInside(e, m)) {
                 missileManager->KillMissile(idx);
                 if (auto* g = GetGameAs<Game>(); g != nullptr) {
-                    g->AdjustPlayerScore(GameConstants::enemy_missile_value * m_waves.GetScoreMultiplier());
+                    const auto score = GameConstants::enemy_missile_value * m_waves.GetScoreMultiplier();
+                    g->AdjustPlayerScore(score);
+                    PublishEvent(GameEvent{GameEventType::EnemyKilled, Faction::Enemy, m, score});
                 }
             }
         }
     }
 }
 
-void GameStateMain::HandleBomberExplosionCollision() noexcept {
-    if (auto* bomber = m_waves.GetBomber(); bomber == nullptr) {
+void GameStateMain::HandleMissileExplosionCollisionsParallel(MissileManager* missileManager) noexcept {
+    auto* g = GetGameAs<Game>();
+    if (g == nullptr) {
         return;
-    } else {
-        const auto& explosions = m_explosionManager.GetExplosionCollisionMeshes();
-        for (const auto& e : explosions) {
-            if (MathUtils::DoDiscsOverlap(e, bomber->GetCollisionMesh())) {
-                bomber->Kill();
-                if (auto* g = GetGameAs<Game>(); g != nullptr) {
-                    g->AdjustPlayerScore(GameConstants::enemy_bomber_value * m_waves.GetScoreMultiplier());
+    }
+    const auto& missiles = missileManager->GetMissilePositions();
+    const auto& explosions = m_explosionManager.GetExplosionCollisionMeshes();
+    m_missileHitCounts.assign(missiles.size(), 0);
+    //Each range writes only its own slice of the hit counts, so no synchronization is needed.
+    g->GetWorkerPool().ParallelFor(missiles.size(), GameConstants::parallel_collision_grain_size, [&](std::size_t begin, std::size_t end) {
+        for (auto idx = begin; idx < end; ++idx) {
+            for (const auto& e : explosions) {
+                if (MathUtils::IsPointInside(e, missiles[idx])) {
+                    ++m_missileHitCounts[idx];
                 }
             }
         }
+    });
+    //Merge in ascending missile order; the score is awarded once per explosion hit exactly like the serial path.
+    const auto score_per_hit = GameConstants::enemy_missile_value * m_waves.GetScoreMultiplier();
+    for (auto idx = std::size_t{}; idx < m_missileHitCounts.size(); ++idx) {
+        if (const auto hits = m_missileHitCounts[idx]; hits > 0) {
+            missileManager->KillMissile(idx);
+            for (int i = 0; i < hits; ++i) {
+                g->AdjustPlayerScore(score_per_hit);
+                PublishEvent(GameEvent{GameEventType::EnemyKilled, Faction::Enemy, missiles[idx], score_per_hit});
+            }
+        }
     }
 }
 
-void GameStateMain::HandleSatelliteExplosionCollision() noexcept {
-    if (auto* sat = m_waves.GetSatellite(); sat == nullptr) {
+void GameStateMain::HandleFlierExplosionCollisions() noexcept {
+    auto& fliers = m_waves.GetFliers();
+    if (fliers.Empty()) {
         return;
-    } else {
-        const auto& explosions = m_explosionManager.GetExplosionCollisionMeshes();
-        for (const auto& e : explosions) {
-            if (MathUtils::DoDiscsOverlap(e, sat->GetCollisionMesh())) {
-                sat->Kill();
+    }
+    const auto& explosions = m_explosionManager.GetExplosionCollisionMeshes();
+    for (const auto& e : explosions) {
+        for (auto idx = std::size_t{}; idx < fliers.Size(); ++idx) {
+            if (MathUtils::DoDiscsOverlap(e, fliers.GetCollisionMesh(idx))) {
+                fliers.Kill(idx);
                 if (auto* g = GetGameAs<Game>(); g != nullptr) {
-                    g->AdjustPlayerScore(GameConstants::enemy_satellite_value * m_waves.GetScoreMultiplier());
+                    const auto value = fliers.GetKind(idx) == FlierKind::Bomber ? GameConstants::enemy_bomber_value : GameConstants::enemy_satellite_value;
+                    const auto score = value * m_waves.GetScoreMultiplier();
+                    g->AdjustPlayerScore(score);
+                    PublishEvent(GameEvent{GameEventType::EnemyKilled, Faction::Enemy, fliers.GetCollisionMesh(idx).center, score});
                 }
             }
         }
@@ -343,6 +525,9 @@ void GameStateMain::HandleCityExplosionCollisions() noexcept {
         auto& city = m_cityManager.GetCity(i);
         for (const auto& explosion : explosions) {
             if (MathUtils::Contains(explosion, city.GetCollisionMesh())) {
+                if (city.IsAlive()) {
+                    PublishEvent(GameEvent{GameEventType::CityLost, Faction::Player, city.GetCollisionMesh().CalcCenter(), i});
+                }
                 city.Kill();
             }
         }
@@ -369,23 +554,15 @@ void GameStateMain::UpdateHighScore() const noexcept {
     }
 }
 
-void GameStateMain::RenderGround() const noexcept {
-    g_theRenderer->SetMaterial(g_theRenderer->GetMaterial("__2D"));
-    const auto S = Matrix4::CreateScaleMatrix(Vector2::One * Vector2{ 1600.0f, 40.0f });
-    const auto R = Matrix4::I;
-    const auto T = Matrix4::CreateTranslationMatrix(Vector2::Y_Axis * 450.0f);
-    const auto M = Matrix4::MakeSRT(S, R, T);
-
-    g_theRenderer->DrawQuad2D(M, Rgba(GameConstants::wave_ground_color_lookup[GetWaveId() % GameConstants::wave_array_size]));
+bool GameStateMain::IsStressModeEnabled() const noexcept {
+    return m_stressMode;
 }
 
-void GameStateMain::RenderObjects() const noexcept {
-    m_waves.Render();
-    m_missileBaseLeft.Render();
-    m_missileBaseCenter.Render();
-    m_missileBaseRight.Render();
-    m_cityManager.Render();
-    m_explosionManager.Render();
+void GameStateMain::RenderStaticScene(const RenderSnapshot& snapshot) const noexcept {
+    if (m_staticScene.IsStale(snapshot.staticSceneGeneration)) {
+        m_staticScene.Rebuild(snapshot, m_renderHandles, m_ground);
+    }
+    m_staticScene.Render(m_renderStats);
 }
 
 void GameStateMain::RenderCrosshair() const noexcept {
@@ -397,57 +574,99 @@ void GameStateMain::RenderCrosshairAt(Vector2 pos) const noexcept {
 }
 
 void GameStateMain::RenderCrosshairAt(Vector2 pos, const Rgba& color) const noexcept {
-    auto* mat = g_theRenderer->GetMaterial("crosshair");
-    g_theRenderer->SetMaterial(mat);
-    const auto&& [x, y, _] = mat->GetTexture(Material::TextureID::Diffuse)->GetDimensions().GetXYZ();
-    const auto dims = IntVector2{ x, y };
-    const auto ui_scale = []() {
-        if (auto* g = GetGameAs<Game>(); g != nullptr) {
-            if (const auto& settings = dynamic_cast<const MySettings*>(g->GetSettings()); settings != nullptr) {
-                return settings->GetUiScale();
-            } else {
-                return 1.0f;
-            }
-        }
-        return 1.0f;
-    }(); //IIIL
-
-    const auto scale = ui_scale * Vector2{ dims };
+    const auto& crosshair = m_renderHandles.GetSprite(SpriteId::Crosshair);
+    g_theRenderer->SetMaterial(crosshair.material);
+    const auto scale = m_uiScale * crosshair.dimensions;
     const auto S = Matrix4::CreateScaleMatrix(scale);
     const auto R = Matrix4::I;
     const auto T = Matrix4::CreateTranslationMatrix(pos);
     const auto M = Matrix4::MakeSRT(S, R, T);
     g_theRenderer->DrawQuad2D(M, color);
+    m_renderStats.AddDraw(RenderSubsystem::Hud, crosshair.material, 4u, 6u);
 }
 
-void GameStateMain::RenderRadarLine() const noexcept {
-    if (IsCrosshairClampedToRadar()) {
+void GameStateMain::RenderRadarLine(const RenderSnapshot& snapshot) const noexcept {
+    if (snapshot.showRadarLine) {
         g_theRenderer->SetModelMatrix();
-        g_theRenderer->SetMaterial("__2D");
+        g_theRenderer->SetMaterial(m_renderHandles.GetFlatMaterial());
         AABB2 cull = m_cameraController.CalcCullBounds();
         cull.maxs.y -= GameConstants::radar_line_distance;
         const auto t = g_theRenderer->GetGameTime().count();
         const auto alpha = MathUtils::SineWave(t, TimeUtils::FPSeconds{ 1.0f });
-        auto color = Rgba(GameConstants::wave_player_color_lookup[this->GetWaveId() % GameConstants::wave_array_size]);
+        auto color = snapshot.playerColor;
         color.ScaleAlpha(alpha);
         g_theRenderer->DrawLine2D(Vector2{ cull.mins.x, cull.maxs.y }, Vector2{ cull.maxs.x, cull.maxs.y }, color);
+        m_renderStats.AddDraw(RenderSubsystem::Hud, m_renderHandles.GetFlatMaterial(), 2u, 2u);
+    }
+}
+
+void GameStateMain::ShowRenderStatsWindow() noexcept {
+    if (ImGui::Begin("Render Stats", &m_showRenderStats)) {
+        if (ImGui::BeginTable("RenderStatsTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Subsystem");
+            ImGui::TableSetupColumn("Draws");
+            ImGui::TableSetupColumn("Vertices");
+            ImGui::TableSetupColumn("Indices");
+            ImGui::TableSetupColumn("Material Switches");
+            ImGui::TableSetupColumn("Batches");
+            ImGui::TableHeadersRow();
+            const auto add_row = [](std::string_view name, const RenderCounters& counters) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%.*s", static_cast<int>(name.size()), name.data());
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", counters.drawCalls);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", counters.vertices);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", counters.indices);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", counters.materialSwitches);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", counters.batches);
+            };
+            const auto& frame = m_renderStats.GetLastFrame();
+            for (std::size_t i = 0u; i < frame.size(); ++i) {
+                add_row(ToString(static_cast<RenderSubsystem>(i)), frame[i]);
+            }
+            add_row("Total", m_renderStats.GetLastFrameTotal());
+            ImGui::EndTable();
+        }
+        ImGui::Text("%zu frames recorded", m_renderStats.GetHistoryFrameCount());
+        if (ImGui::Button("Export CSV")) {
+            if (m_renderStats.ExportCsv(GameConstants::game_render_stats_path)) {
+                g_theFileLogger->LogLine(std::format("Render stats written to {}", GameConstants::game_render_stats_path.string()));
+            } else {
+                g_theFileLogger->LogWarnLine(std::format("Could not write render stats to {}", GameConstants::game_render_stats_path.string()));
+            }
+        }
     }
+    ImGui::End();
 }
 
 std::size_t GameStateMain::GetWaveId() const noexcept {
     return m_waves.GetWaveId();
 }
 
+void GameStateMain::ReloadWaveParams() noexcept {
+    m_waves.ReloadWaveParams();
+    m_hudDirty = true;
+}
+
+const RenderHandles& GameStateMain::GetRenderHandles() const noexcept {
+    return m_renderHandles;
+}
+
+void GameStateMain::InvalidateStaticScene() noexcept {
+    m_staticSceneGeneration.fetch_add(1u, std::memory_order_release);
+}
+
 Rgba GameStateMain::GetGroundColor() const noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-    return Rgba(GameConstants::wave_ground_color_lookup[state->GetWaveId() % GameConstants::wave_array_size]);
+    return m_waves.GetWaveParams().groundColor;
 }
 
 Rgba GameStateMain::GetPlayerColor() const noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-    return Rgba(GameConstants::wave_player_color_lookup[state->GetWaveId() % GameConstants::wave_array_size]);
+    return m_waves.GetWaveParams().playerColor;
 }
 
 const OrthographicCameraController& GameStateMain::GetCameraController() const noexcept {
@@ -473,6 +692,9 @@ void GameStateMain::HandleDebugKeyboardInput(TimeUtils::FPSeconds /*deltaSeconds
     if (g_theInputSystem->WasKeyJustPressed(KeyCode::F1)) {
         g_theUISystem->ToggleClayDebugWindow();
     }
+    if (g_theInputSystem->WasKeyJustPressed(KeyCode::F2)) {
+        m_showRenderStats = !m_showRenderStats;
+    }
 }
 
 void GameStateMain::HandleDebugMouseInput(TimeUtils::FPSeconds /*deltaSeconds*/) {
@@ -483,7 +705,9 @@ void GameStateMain::HandleDebugMouseInput(TimeUtils::FPSeconds /*deltaSeconds*/)
 
 void GameStateMain::Render() const noexcept {
 
-    g_theRenderer->BeginRenderToBackbuffer(m_waves.GetBackgroundColor());
+    const auto& snapshot = m_snapshots.AcquireFront();
+    m_renderStats.BeginFrame();
+    g_theRenderer->BeginRenderToBackbuffer(snapshot.backgroundColor);
 
 
     //3D World View
@@ -499,10 +723,131 @@ void GameStateMain::Render() const noexcept {
 
         g_theRenderer->BeginHUDRender(m_ui_camera.GetCamera(), ui_cam_pos, ui_view_height);
 
-        RenderGround();
-        RenderObjects();
-        RenderCrosshairAt(m_mouse_world_pos);
-        RenderRadarLine();
+        RenderStaticScene(snapshot);
+        const auto pixels_per_unit = Vector2{ g_theRenderer->GetOutput()->GetDimensions() }.y / m_ui_camera.CalcViewBounds().CalcDimensions().y;
+        snapshot.Render(m_spriteBatcher, m_geometryBuilder, m_renderHandles, pixels_per_unit, m_renderStats);
+        RenderCrosshairAt(snapshot.crosshairPosition);
+        RenderRadarLine(snapshot);
+    }
+    if (m_softwareRaster) {
+        QueueSoftwareRaster(snapshot);
+    }
+    m_renderStats.EndFrame();
+    m_snapshots.ReleaseFront();
+}
+
+void GameStateMain::QueueSoftwareRaster(const RenderSnapshot& snapshot) const noexcept {
+    if (!m_softwareRasterThread.joinable()) {
+        return;
+    }
+    auto sequence = std::uint64_t{0u};
+    {
+        std::unique_lock lock(m_softwareRasterMutex);
+        sequence = m_softwareRasterQueuedCount;
+        if (sequence - m_softwareRasterDoneCount == m_softwareRasterJobs.size()) {
+            const auto start = TimeUtils::Now();
+            m_softwareRasterFinished.wait(lock, [this, sequence]() { return sequence - m_softwareRasterDoneCount < m_softwareRasterJobs.size(); });
+            m_softwareRasterWaitTime += TimeUtils::Now() - start;
+            ++m_softwareRasterWaits;
+        }
+    }
+    //The job is owned by this thread until it is queued, so the copy happens outside the lock.
+    //Assignment reuses the copy's capacity, so after the first few frames this only copies the primitives.
+    auto& job = m_softwareRasterJobs[sequence % m_softwareRasterJobs.size()];
+    job.snapshot = snapshot;
+    job.view = m_ui_camera.CalcViewBounds();
+    job.radarBounds = m_cameraController.CalcCullBounds();
+    job.radarBounds.maxs.y -= GameConstants::radar_line_distance;
+    {
+        std::scoped_lock lock(m_softwareRasterMutex);
+        ++m_softwareRasterQueuedCount;
+    }
+    m_softwareRasterQueued.notify_one();
+}
+
+void GameStateMain::SoftwareRasterLoop(std::stop_token stopToken) noexcept {
+    for (;;) {
+        auto sequence = std::uint64_t{0u};
+        {
+            std::unique_lock lock(m_softwareRasterMutex);
+            m_softwareRasterQueued.wait(lock, stopToken, [this]() { return m_softwareRasterDoneCount != m_softwareRasterQueuedCount; });
+            //A stop request still draws every frame queued before it.
+            if (m_softwareRasterDoneCount == m_softwareRasterQueuedCount) {
+                return;
+            }
+            sequence = m_softwareRasterDoneCount;
+        }
+        const auto& job = m_softwareRasterJobs[sequence % m_softwareRasterJobs.size()];
+        RasterizeSnapshot(job.snapshot, job.view, job.radarBounds);
+        {
+            std::scoped_lock lock(m_softwareRasterMutex);
+            ++m_softwareRasterDoneCount;
+        }
+        m_softwareRasterFinished.notify_one();
+    }
+}
+
+void GameStateMain::RasterizeSnapshot(const RenderSnapshot& snapshot, const AABB2& view, const AABB2& radarBounds) const noexcept {
+    const auto start = TimeUtils::Now();
+    m_softwareRasterizer.Begin(view, snapshot.backgroundColor);
+    snapshot.Rasterize(m_softwareRasterizer, m_renderHandles, m_ground);
+    m_softwareRasterizer.DrawRect(snapshot.crosshairPosition, m_uiScale * m_renderHandles.GetSprite(SpriteId::Crosshair).dimensions, Rgba::White);
+    if (snapshot.showRadarLine) {
+        m_softwareRasterizer.DrawLine(Vector2{ radarBounds.mins.x, radarBounds.maxs.y }, Vector2{ radarBounds.maxs.x, radarBounds.maxs.y }, snapshot.playerColor);
+    }
+    auto* g = GetGameAs<Game>();
+    m_softwareRasterizer.End(g != nullptr ? &g->GetWorkerPool() : nullptr);
+    m_softwareRasterTime += TimeUtils::Now() - start;
+    ++m_softwareRasterFrames;
+    if (m_frameCapture.IsRunning()) {
+        m_frameCapture.Submit(m_softwareRasterizer.GetPixels(), m_softwareRasterizer.GetWidth(), m_softwareRasterizer.GetHeight());
+    }
+}
+
+void GameStateMain::StopSoftwareRaster() noexcept {
+    //Assigning an empty thread requests a stop and joins.
+    m_softwareRasterThread = std::jthread{};
+}
+
+void GameStateMain::LogAutoplayReport() const noexcept {
+    const auto& stats = m_autoplayBot.GetStats();
+    const auto average = stats.intervalFrames != 0u ? TimeUtils::FPMilliseconds{ stats.intervalFrameTime } / static_cast<float>(stats.intervalFrames) : TimeUtils::FPMilliseconds::zero();
+    const auto* enemy_missiles = m_waves.GetMissileManager();
+    const auto player_missiles = m_missileBaseLeft.GetMissileManager().ActiveMissileCount() + m_missileBaseCenter.GetMissileManager().ActiveMissileCount() + m_missileBaseRight.GetMissileManager().ActiveMissileCount();
+    //Live entity counts should stay flat from report to report; steady growth points to a leak.
+    g_theFileLogger->LogLine(std::format("Autoplay: {:.0f} s, {} frames, wave {}, {} shots, frame avg {:.2f} ms, max {:.2f} ms, enemy missiles {}, player missiles {}, explosions {}, cities {}, dropped events {}"
+        , stats.playTime.count()
+        , stats.frames
+        , stats.waveId
+        , stats.shots
+        , average.count()
+        , TimeUtils::FPMilliseconds{ stats.maxFrameTime }.count()
+        , enemy_missiles != nullptr ? enemy_missiles->ActiveMissileCount() : std::size_t{0u}
+        , player_missiles
+        , m_explosionManager.ActiveExplosionCount()
+        , m_cityManager.RemainingCitiesCount()
+        , m_events.GetDroppedCount()));
+    if (m_autoplayBot.IsWaveStalled()) {
+        g_theFileLogger->LogWarnLine(std::format("Autoplay: wave {} has not advanced in {:.0f} s.", stats.waveId, (stats.playTime - stats.waveStartTime).count()));
+    }
+}
+
+void GameStateMain::LogSoftwareRasterStats() const noexcept {
+    if (m_softwareRasterFrames == 0u) {
+        return;
+    }
+    const auto average = TimeUtils::FPMilliseconds{ m_softwareRasterTime } / static_cast<float>(m_softwareRasterFrames);
+    g_theFileLogger->LogLine(std::format("Software raster: {} frames at {}x{}, {:.3f} ms average, render thread waited {} times for {:.1f} ms", m_softwareRasterFrames, m_softwareRasterizer.GetWidth(), m_softwareRasterizer.GetHeight(), average.count(), m_softwareRasterWaits, TimeUtils::FPMilliseconds{ m_softwareRasterWaitTime }.count()));
+}
+
+void GameStateMain::StopFrameCapture() noexcept {
+    if (!m_frameCapture.IsRunning()) {
+        return;
+    }
+    m_frameCapture.Stop();
+    g_theFileLogger->LogLine(std::format("Raster capture: {} written, {} failed to {}", m_frameCapture.GetWrittenCount(), m_frameCapture.GetFailedCount(), GameConstants::game_raster_capture_folder.string()));
+    if (const auto dropped = m_frameCapture.GetDroppedCount(); dropped != 0u) {
+        g_theFileLogger->LogWarnLine(std::format("Raster capture: {} frames dropped while every encoder slot was busy; they are missing from the numbered sequence.", dropped));
     }
 }
 
@@ -515,10 +860,116 @@ void GameStateMain::EndFrame() noexcept {
         }
     }
     m_mouse_delta = Vector2::Zero;
-    m_missileBaseLeft.EndFrame();
-    m_missileBaseCenter.EndFrame();
-    m_missileBaseRight.EndFrame();
-    m_cityManager.EndFrame();
-    m_explosionManager.EndFrame();
-    m_waves.EndFrame();
+    m_endFrameGraph.Run(GetFrameWorkerPool());
+    DispatchGameEvents();
+    CaptureRenderSnapshot();
+}
+
+void GameStateMain::CaptureRenderSnapshot() noexcept {
+    auto& snapshot = m_snapshots.BeginWrite();
+    const auto& params = m_waves.GetWaveParams();
+    snapshot.backgroundColor = params.backgroundColor;
+    snapshot.groundColor = params.groundColor;
+    snapshot.playerColor = params.playerColor;
+    snapshot.crosshairPosition = m_mouse_world_pos;
+    snapshot.showRadarLine = IsCrosshairClampedToRadar();
+    snapshot.staticSceneGeneration = m_staticSceneGeneration.load(std::memory_order_acquire);
+    m_waves.AppendToSnapshot(snapshot);
+    m_missileBaseLeft.AppendToSnapshot(snapshot);
+    m_missileBaseCenter.AppendToSnapshot(snapshot);
+    m_missileBaseRight.AppendToSnapshot(snapshot);
+    m_cityManager.AppendToSnapshot(snapshot);
+    m_explosionManager.AppendToSnapshot(snapshot);
+    m_snapshots.Publish();
+}
+
+void GameStateMain::PublishEvent(const GameEvent& event) noexcept {
+    m_events.Publish(event);
+}
+
+const HudModel& GameStateMain::GetHud() const noexcept {
+    return m_hud;
+}
+
+void GameStateMain::DispatchGameEvents() noexcept {
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        auto& sounds = g->GetSoundBoard();
+        m_events.Drain(GameEventChannel::Audio, [&sounds](const GameEvent& event) { PlayEventAudio(sounds, event); });
+        sounds.Flush();
+    }
+    m_events.Drain(GameEventChannel::UI, [this](const GameEvent& event) {
+        switch (event.type) {
+        case GameEventType::EnemyKilled:
+        case GameEventType::ScoreTallied:
+        case GameEventType::WaveChanged:
+            m_hudDirty = true;
+            break;
+        default:
+            break;
+        }
+    });
+    m_events.Drain(GameEventChannel::Metrics, [this](const GameEvent& event) {
+        ++m_eventTotals[static_cast<std::size_t>(event.type)];
+    });
+    RefreshHud();
+}
+
+void GameStateMain::PlayEventAudio(SoundBoard& sounds, const GameEvent& event) noexcept {
+    switch (event.type) {
+    case GameEventType::MissileLaunched:
+        if (event.faction == Faction::Player) {
+            sounds.Request(SoundId::LaunchMissile, AudioSystem::SoundDesc{});
+        }
+        break;
+    case GameEventType::Explosion:
+        sounds.Request(SoundId::Explosion, AudioSystem::SoundDesc{});
+        break;
+    case GameEventType::FlierSpawned:
+        sounds.Request(static_cast<FlierKind>(event.value) == FlierKind::Bomber ? SoundId::Bomber : SoundId::Satellite, AudioSystem::SoundDesc{});
+        break;
+    case GameEventType::ScoreTallied:
+        sounds.Request(SoundId::Counting, AudioSystem::SoundDesc{});
+        break;
+    case GameEventType::BonusCity:
+        sounds.Request(SoundId::BonusCity, AudioSystem::SoundDesc{});
+        break;
+    case GameEventType::LowMissiles:
+        sounds.Request(SoundId::LowMissiles, AudioSystem::SoundDesc{.loopCount = 3, .stopWhenFinishedLooping = true});
+        break;
+    case GameEventType::OutOfMissiles:
+        sounds.Request(SoundId::NoMissiles, AudioSystem::SoundDesc{});
+        break;
+    default:
+        break;
+    }
+}
+
+void GameStateMain::RefreshHud() noexcept {
+    if (!m_hudDirty) {
+        return;
+    }
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        m_hud.Update(HudValues{g->GetPlayerScore(), g->GetHighScore(), GetWaveId() + 1, m_waves.GetScoreMultiplier()});
+        m_hudDirty = false;
+    }
+}
+
+void GameStateMain::LogEventTotals() const noexcept {
+    g_theFileLogger->LogLine(std::format("Gameplay events: launched {}, explosions {}, fliers {}, kills {}, cities lost {}, waves {}, dropped {}"
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::MissileLaunched)]
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::Explosion)]
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::FlierSpawned)]
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::EnemyKilled)]
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::CityLost)]
+        , m_eventTotals[static_cast<std::size_t>(GameEventType::WaveChanged)]
+        , m_events.GetDroppedCount()));
+    if (auto* g = GetGameAs<Game>(); g != nullptr) {
+        const auto& sounds = g->GetSoundBoard();
+        g_theFileLogger->LogLine(std::format("Sounds: played {}, merged {}, stolen {}, limited {}, dropped {} in {} batches", sounds.GetPlayedCount(), sounds.GetMergedCount(), sounds.GetStolenCount(), sounds.GetLimitedCount(), sounds.GetDroppedCount(), sounds.GetBatchCount()));
+        if (const auto& device = g->GetWaveOutDevice(); device.IsRunning()) {
+            const auto mix = g->GetSoftwareMixer().GetStats();
+            const auto average = mix.blocks != 0u ? mix.totalTime.count() / static_cast<float>(mix.blocks) : 0.0f;
+            g_theFileLogger->LogLine(std::format("Software mixer: {} blocks, avg {:.2f} us, last {:.2f} us, max {:.2f} us, peak voices {}, underruns {}", mix.blocks, average, mix.lastBlock.count(), mix.maxBlock.count(), mix.peakVoices, device.GetUnderrunCount()));
+        }
+    }
 }
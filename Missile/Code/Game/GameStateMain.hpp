@@ -9,16 +9,43 @@
 
 #include "Game/GameState.hpp"
 
+#include "Game/AutoplayBot.hpp"
 #include "Game/EnemyWave.hpp"
 #include "Game/MissileBase.hpp"
 #include "Game/MissileManager.hpp"
 #include "Game/ExplosionManager.hpp"
+#include "Game/FrameCapture.hpp"
+#include "Game/GameEvents.hpp"
+#include "Game/HudModel.hpp"
+#include "Game/InterceptSolver.hpp"
 #include "Game/CityManager.hpp"
+#include "Game/RenderHandles.hpp"
+#include "Game/RenderSnapshot.hpp"
+#include "Game/RenderStats.hpp"
+#include "Game/SoundBoard.hpp"
+#include "Game/SoftwareRasterizer.hpp"
+#include "Game/SpriteBatcher.hpp"
+#include "Game/StaticSceneLayer.hpp"
+#include "Game/TargetTable.hpp"
+#include "Game/TaskGraph.hpp"
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
 
 class GameStateMain : public GameState {
 public:
+    GameStateMain() = default;
+    GameStateMain(const GameStateMain& other) = delete;
+    GameStateMain(GameStateMain&& other) = delete;
+    GameStateMain& operator=(const GameStateMain& other) = delete;
+    GameStateMain& operator=(GameStateMain&& other) = delete;
     virtual ~GameStateMain() = default;
 
     void BeginFrame() noexcept override;
@@ -28,7 +55,13 @@ public:
     void OnEnter() noexcept override;
     void OnExit() noexcept override;
 
-    const std::array<MissileManager::Target, 9> GetValidTargets() const noexcept;
+    //A weighted random city or base that is still standing.
+    MissileManager::Target PickEnemyTarget() noexcept;
+    //Call whenever a city or base is destroyed or rebuilt. Safe from any frame graph node.
+    void InvalidateTargets() noexcept;
+    //Where to catch each live enemy missile and from which base: 0 is left, 1 center, 2 right.
+    //Reads the enemy missiles and the bases, so it belongs after both have updated.
+    const InterceptSolver& SolveIntercepts() noexcept;
     AABB2 GetWorldBounds() const noexcept;
     bool HasMissilesRemaining() const noexcept;
     void ResetMissileCount() noexcept;
@@ -47,15 +80,33 @@ public:
 
     void CreateExplosionAt(Vector2 position, Faction faction) noexcept;
     std::size_t GetWaveId() const noexcept;
+    //Picks up retuned wave definitions mid-wave.
+    void ReloadWaveParams() noexcept;
+
+    void PublishEvent(const GameEvent& event) noexcept;
+    const HudModel& GetHud() const noexcept;
+
+    const RenderHandles& GetRenderHandles() const noexcept;
+    //Call whenever ground, base or city appearance changes. Safe from any frame graph node.
+    void InvalidateStaticScene() noexcept;
 
     Rgba GetGroundColor() const noexcept;
     Rgba GetPlayerColor() const noexcept;
 
+    bool IsStressModeEnabled() const noexcept;
+
     const OrthographicCameraController& GetCameraController() const noexcept;
     OrthographicCameraController& GetCameraController() noexcept;
 
 protected:
 private:
+    //One frame handed to the raster thread. The bounds are taken on the render thread, since the cameras keep moving while the raster runs.
+    struct SoftwareRasterJob {
+        RenderSnapshot snapshot{};
+        AABB2 view{};
+        AABB2 radarBounds{};
+    };
+
 
     void HandleDebugInput(TimeUtils::FPSeconds deltaSeconds);
     void HandleDebugKeyboardInput(TimeUtils::FPSeconds deltaSeconds);
@@ -65,6 +116,9 @@ private:
     void HandleKeyboardInput(TimeUtils::FPSeconds deltaSeconds);
     void HandleControllerInput(TimeUtils::FPSeconds deltaSeconds);
     void HandleMouseInput(TimeUtils::FPSeconds deltaSeconds);
+    void HandleAutoplay(TimeUtils::FPSeconds deltaSeconds) noexcept;
+    //launcher is 0 for the left base, 1 for the center and 2 for the right, as with the A, W and D keys.
+    void FireFrom(std::size_t launcher, MissileManager::Target target) noexcept;
 
     void CalculateCrosshairLocation() noexcept;
     void ClampCrosshairToRadar() noexcept;
@@ -77,35 +131,100 @@ private:
     Vector2 BaseLocationCenter() const noexcept;
     Vector2 BaseLocationRight() const noexcept;
     Vector2 CityLocation(std::size_t index) const noexcept;
+    void RefreshTargets() noexcept;
 
     void HandleMissileExplosionCollisions(MissileManager* missileManager) noexcept;
-    void HandleBomberExplosionCollision() noexcept;
-    void HandleSatelliteExplosionCollision() noexcept;
+    void HandleMissileExplosionCollisionsParallel(MissileManager* missileManager) noexcept;
+    void HandleFlierExplosionCollisions() noexcept;
     void HandleMissileGroundCollisions(MissileManager* missileManager) noexcept;
     void HandleCityExplosionCollisions() noexcept;
     void HandleBaseExplosionCollisions() noexcept;
 
     void UpdateHighScore() const noexcept;
 
-    void RenderGround() const noexcept;
-    void RenderObjects() const noexcept;
+    void BuildFrameGraphs() noexcept;
+    WorkerPool* GetFrameWorkerPool() const noexcept;
+
+    void DispatchGameEvents() noexcept;
+    static void PlayEventAudio(SoundBoard& sounds, const GameEvent& event) noexcept;
+    void RefreshHud() noexcept;
+    void LogEventTotals() const noexcept;
+    void LogAutoplayReport() const noexcept;
+
+    //Copies everything the next Render needs out of the simulation. Called once the frame's state is final.
+    void CaptureRenderSnapshot() noexcept;
+
+    void RenderStaticScene(const RenderSnapshot& snapshot) const noexcept;
+    //Copies the snapshot for the raster thread to draw into the CPU framebuffer, after the GPU path has drawn it.
+    //Every frame is drawn: when both jobs are still queued or being drawn, this waits for the raster thread.
+    void QueueSoftwareRaster(const RenderSnapshot& snapshot) const noexcept;
+    void SoftwareRasterLoop(std::stop_token stopToken) noexcept;
+    void RasterizeSnapshot(const RenderSnapshot& snapshot, const AABB2& view, const AABB2& radarBounds) const noexcept;
+    void StopSoftwareRaster() noexcept;
+    void LogSoftwareRasterStats() const noexcept;
+    void StopFrameCapture() noexcept;
     void RenderCrosshair() const noexcept;
     void RenderCrosshairAt(Vector2 pos) const noexcept;
     void RenderCrosshairAt(Vector2 pos, const Rgba& color) const noexcept;
-    void RenderRadarLine() const noexcept;
+    void RenderRadarLine(const RenderSnapshot& snapshot) const noexcept;
+    void ShowRenderStatsWindow() noexcept;
 
     OrthographicCameraController m_cameraController{};
     mutable OrthographicCameraController m_ui_camera{};
-    EnemyWave m_waves{};
-    MissileBase m_missileBaseLeft{};
-    MissileBase m_missileBaseCenter{};
-    MissileBase m_missileBaseRight{};
+    //Owned objects keep a pointer back to this state for its whole lifetime, so it must never be copied or moved.
+    EnemyWave m_waves{this};
+    MissileBase m_missileBaseLeft{this};
+    MissileBase m_missileBaseCenter{this};
+    MissileBase m_missileBaseRight{this};
     ExplosionManager m_explosionManager{};
-    CityManager m_cityManager{};
+    CityManager m_cityManager{this};
     AABB2 m_world_bounds{ AABB2::Zero_to_One };
     AABB2 m_ground{ Vector2::Y_Axis * 450.0f, 800.0f, 20.0f };
     Vector2 m_mouse_pos{};
     Vector2 m_mouse_world_pos{};
     Vector2 m_mouse_delta{};
+    std::vector<int> m_missileHitCounts{};
+    GameEventBus m_events{};
+    std::array<std::uint64_t, static_cast<std::size_t>(GameEventType::Max)> m_eventTotals{};
+    HudModel m_hud{};
+    bool m_hudDirty{true};
+    TaskGraph m_beginFrameGraph{};
+    TaskGraph m_updateGraph{};
+    TaskGraph m_endFrameGraph{};
+    RenderHandles m_renderHandles{};
+    mutable RenderSnapshotBuffer m_snapshots{};
+    mutable SpriteBatcher m_spriteBatcher{};
+    mutable Mesh::Builder m_geometryBuilder{};
+    mutable StaticSceneLayer m_staticScene{};
+    mutable SoftwareRasterizer m_softwareRasterizer{};
+    mutable TimeUtils::FPSeconds m_softwareRasterTime{};
+    mutable std::uint64_t m_softwareRasterFrames{0u};
+    mutable std::uint64_t m_softwareRasterWaits{0u};
+    mutable TimeUtils::FPSeconds m_softwareRasterWaitTime{};
+    //Job n % 2 belongs to the raster thread from the time job n is queued until the done count passes it,
+    //so the render thread can fill one job while the other is drawn.
+    mutable std::array<SoftwareRasterJob, 2> m_softwareRasterJobs{};
+    mutable std::uint64_t m_softwareRasterQueuedCount{0u};
+    mutable std::uint64_t m_softwareRasterDoneCount{0u};
+    mutable std::mutex m_softwareRasterMutex{};
+    mutable std::condition_variable_any m_softwareRasterQueued{};
+    mutable std::condition_variable_any m_softwareRasterFinished{};
+    mutable FrameCapture m_frameCapture{};
+    mutable RenderStats m_renderStats{};
+    std::atomic<std::uint32_t> m_staticSceneGeneration{1u};
+    TargetTable m_targets{};
+    std::atomic<std::uint32_t> m_targetGeneration{1u};
+    std::uint32_t m_targetTableGeneration{0u};
+    InterceptSolver m_interceptSolver{};
+    AutoplayBot m_autoplayBot{};
+    TimeUtils::FPSeconds m_frameDeltaSeconds{};
+    float m_uiScale{1.0f};
+    bool m_stressMode{false};
+    bool m_softwareRaster{false};
+    bool m_captureRasterFrames{false};
+    bool m_autoplay{false};
+    bool m_showRenderStats{false};
+    //Declared last so it is joined before anything it draws from is destroyed.
+    std::jthread m_softwareRasterThread{};
 
 };
@@ -0,0 +1,74 @@
+#include "Game/Headless.hpp"
+
+#include "Game/GameCommon.hpp"
+#include "Game/MixerBenchmark.hpp"
+#include "Game/RasterScenes.hpp"
+#include "Game/SoftwareMixer.hpp"
+#include "Game/SoundBank.hpp"
+#include "Game/WorkerPool.hpp"
+
+#include <algorithm>
+#include <format>
+#include <string_view>
+
+namespace {
+    void PrintRasterResult(std::ostream& out, std::string_view name, const RasterScenes::Scene& scene, const RasterScenes::BenchmarkResult& result) noexcept {
+        out << std::format("Raster benchmark, {}: {}x{}, {} primitives, {} frames, avg {:.3f} ms, p99 {:.3f} ms, max {:.3f} ms, {:.0f} frames/s\n"
+            , name, scene.width, scene.height, result.primitives, result.frames, result.average.count(), result.p99.count(), result.max.count(), result.framesPerSecond);
+    }
+
+    int RunRasterBenchmark(std::ostream& out) noexcept {
+        const auto scene = RasterScenes::BuildStressScene(GameConstants::raster_benchmark_width, GameConstants::raster_benchmark_height, GameConstants::raster_benchmark_explosion_count, GameConstants::raster_benchmark_trail_count);
+        PrintRasterResult(out, "one thread", scene, RasterScenes::Benchmark(scene, nullptr, GameConstants::raster_benchmark_frame_count));
+        auto pool = WorkerPool{};
+        PrintRasterResult(out, std::format("{} workers", pool.GetWorkerCount()), scene, RasterScenes::Benchmark(scene, &pool, GameConstants::raster_benchmark_frame_count));
+        return 0;
+    }
+
+    void PrintMixerResult(std::ostream& out, std::string_view name, std::uint32_t outputRate, const MixerBenchmark::Result& result) noexcept {
+        out << std::format("Mixer benchmark, {}: {} voices at {} Hz, {} blocks, avg {:.2f} us, p99 {:.2f} us, max {:.2f} us, {:.0f}x realtime\n"
+            , name, result.voices, outputRate, result.blocks, result.average.count(), result.p99.count(), result.max.count(), result.realtimeFactor);
+    }
+
+    int RunMixerBenchmark(std::ostream& out) noexcept {
+        if (SoundBank::IsStale(GameConstants::game_audio_folder, GameConstants::game_sound_bank_path) && !SoundBank::Build(GameConstants::game_audio_folder, GameConstants::game_sound_bank_path)) {
+            out << "Could not build the sound bank.\n";
+        }
+        auto bank = SoundBank{};
+        if (!bank.Open(GameConstants::game_sound_bank_path)) {
+            out << std::format("Could not open the sound bank {}.\n", GameConstants::game_sound_bank_path.string());
+            return 1;
+        }
+        const auto output_rate = GameConstants::software_mixer_output_rate;
+        const auto capped = MixerBenchmark::Run(bank, output_rate, 1u, GameConstants::mixer_benchmark_block_count);
+        PrintMixerResult(out, "capped", output_rate, capped);
+        PrintMixerResult(out, std::format("caps x{}", GameConstants::mixer_benchmark_uncapped_scale), output_rate, MixerBenchmark::Run(bank, output_rate, GameConstants::mixer_benchmark_uncapped_scale, GameConstants::mixer_benchmark_block_count));
+        const auto paced = MixerBenchmark::RunPaced(bank, output_rate, TimeUtils::FPSeconds{ GameConstants::mixer_benchmark_paced_seconds });
+        out << std::format("Mixer benchmark, paced: {} voices at {} Hz, {} blocks in {:.0f} s, avg {:.2f} us, max {:.2f} us, {} underruns\n"
+            , paced.voices, output_rate, paced.blocks, GameConstants::mixer_benchmark_paced_seconds, paced.average.count(), paced.max.count(), paced.underruns);
+        const auto budget = TimeUtils::FPMicroseconds{ TimeUtils::FPSeconds{ static_cast<float>(SoftwareMixer::block_frames) / static_cast<float>(output_rate) } };
+        if (capped.p99 > budget) {
+            out << std::format("Mixer benchmark: capped p99 of {:.2f} us exceeds the {:.2f} us block.\n", capped.p99.count(), budget.count());
+        }
+        return 0;
+    }
+}
+
+std::optional<int> Headless::Run(std::span<const std::string> args, std::ostream& out) noexcept {
+    const auto has = [args](std::string_view command) { return std::find(args.begin(), args.end(), command) != args.end(); };
+    if (has("-raster-check")) {
+        auto pool = WorkerPool{};
+        return static_cast<int>(RasterScenes::CheckGolden(GameConstants::game_raster_golden_folder, &pool, out));
+    }
+    if (has("-raster-update")) {
+        auto pool = WorkerPool{};
+        return RasterScenes::UpdateGolden(GameConstants::game_raster_golden_folder, &pool, out) ? 0 : 1;
+    }
+    if (has("-raster-bench")) {
+        return RunRasterBenchmark(out);
+    }
+    if (has("-mixer-bench")) {
+        return RunMixerBenchmark(out);
+    }
+    return std::nullopt;
+}
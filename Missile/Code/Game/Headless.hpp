@@ -0,0 +1,18 @@
+#pragma once
+
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+
+//Commands run from the command line without booting the engine: no window, renderer or audio device is created,
+//so they work on machines without a GPU or sound card. Each prints a report to out.
+//  -raster-check    compare the software rasterizer with the golden images, exit code is the number of failures
+//  -raster-update   rewrite the golden images from the current rasterizer
+//  -raster-bench    time the rasterizer on a stress-mode frame, on one thread and on the worker pool
+//  -mixer-bench     time the software mixer on a stress-mode chain reaction, back to back and paced on the null device
+//The game is a GUI-subsystem program, so from cmd.exe use start /wait to see the exit code.
+namespace Headless {
+    //Returns the process exit code, or nothing if args hold no headless command and the game should start.
+    std::optional<int> Run(std::span<const std::string> args, std::ostream& out) noexcept;
+}
@@ -0,0 +1,33 @@
+#include "Game/HudModel.hpp"
+
+#include <format>
+#include <iterator>
+
+bool HudModel::Update(const HudValues& values) noexcept {
+    if (m_valid && values == m_values) {
+        return false;
+    }
+    const auto score_changed = !m_valid || values.score != m_values.score || values.highScore != m_values.highScore || values.wave != m_values.wave;
+    const auto multiplier_changed = !m_valid || values.multiplier != m_values.multiplier;
+    m_values = values;
+    m_valid = true;
+    //format_to into the cleared strings reuses their capacity.
+    if (score_changed) {
+        m_scoreText.clear();
+        const auto* arrow = m_values.highScore < m_values.score ? "<-" : "->";
+        std::format_to(std::back_inserter(m_scoreText), "{} {} {}\nWave: {}", m_values.score, arrow, m_values.highScore, m_values.wave);
+    }
+    if (multiplier_changed) {
+        m_multiplierText.clear();
+        std::format_to(std::back_inserter(m_multiplierText), "{} X POINTS", m_values.multiplier);
+    }
+    return true;
+}
+
+const std::string& HudModel::GetScoreText() const noexcept {
+    return m_scoreText;
+}
+
+const std::string& HudModel::GetMultiplierText() const noexcept {
+    return m_multiplierText;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+struct HudValues {
+    int score{0};
+    int highScore{0};
+    std::size_t wave{0u};
+    int multiplier{1};
+
+    bool operator==(const HudValues& rhs) const noexcept = default;
+};
+
+//Text shown by the wave HUDs. Strings are regenerated only for the values that changed since the last Update.
+class HudModel {
+public:
+    HudModel() = default;
+    HudModel(const HudModel& other) = default;
+    HudModel(HudModel&& other) = default;
+    HudModel& operator=(const HudModel& other) = default;
+    HudModel& operator=(HudModel&& other) = default;
+    ~HudModel() = default;
+
+    //Returns true if any text changed.
+    bool Update(const HudValues& values) noexcept;
+
+    const std::string& GetScoreText() const noexcept;
+    const std::string& GetMultiplierText() const noexcept;
+
+protected:
+private:
+    HudValues m_values{};
+    std::string m_scoreText{};
+    std::string m_multiplierText{};
+    bool m_valid{false};
+};
@@ -0,0 +1,155 @@
+#include "Game/InterceptSolver.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MISSILE_INTERCEPT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+    struct Candidate {
+        std::int32_t launcher{InterceptSolver::no_launcher};
+        //Launch to detonation plus the lead, the same for every threat.
+        float time{0.0f};
+        Vector2 position{};
+    };
+
+#ifdef MISSILE_INTERCEPT_SSE2
+    __m128 Select(__m128 mask, __m128 a, __m128 b) noexcept {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    __m128i Select(__m128i mask, __m128i a, __m128i b) noexcept {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+#endif
+}
+
+void InterceptSolver::ClearThreats() noexcept {
+    m_positionX.clear();
+    m_positionY.clear();
+    m_velocityX.clear();
+    m_velocityY.clear();
+    m_timeToImpact.clear();
+}
+
+void InterceptSolver::ReserveThreats(std::size_t count) noexcept {
+    m_positionX.reserve(count);
+    m_positionY.reserve(count);
+    m_velocityX.reserve(count);
+    m_velocityY.reserve(count);
+    m_timeToImpact.reserve(count);
+}
+
+void InterceptSolver::AddThreat(Vector2 position, Vector2 velocity, TimeUtils::FPSeconds timeToImpact) noexcept {
+    m_positionX.push_back(position.x);
+    m_positionY.push_back(position.y);
+    m_velocityX.push_back(velocity.x);
+    m_velocityY.push_back(velocity.y);
+    m_timeToImpact.push_back(timeToImpact.count());
+}
+
+std::size_t InterceptSolver::GetThreatCount() const noexcept {
+    return m_positionX.size();
+}
+
+void InterceptSolver::Solve(std::span<const Launcher> launchers, const AABB2& area, TimeUtils::FPSeconds detonationLead) noexcept {
+    auto candidates = std::vector<Candidate>{};
+    candidates.reserve(launchers.size());
+    for (std::size_t i = 0u; i < launchers.size(); ++i) {
+        if (0 < launchers[i].missilesRemaining) {
+            candidates.push_back(Candidate{ static_cast<std::int32_t>(i), (launchers[i].timeToTarget + detonationLead).count(), launchers[i].position });
+        }
+    }
+
+    const auto count = GetThreatCount();
+    m_launcher.resize(count);
+    m_aimX.resize(count);
+    m_aimY.resize(count);
+    m_interceptTime.resize(count);
+    constexpr const auto infinity = std::numeric_limits<float>::infinity();
+
+    auto i = std::size_t{0u};
+#ifdef MISSILE_INTERCEPT_SSE2
+    const auto inf = _mm_set1_ps(infinity);
+    const auto min_x = _mm_set1_ps(area.mins.x);
+    const auto min_y = _mm_set1_ps(area.mins.y);
+    const auto max_x = _mm_set1_ps(area.maxs.x);
+    const auto max_y = _mm_set1_ps(area.maxs.y);
+    for (; i + 4u <= count; i += 4u) {
+        const auto px = _mm_loadu_ps(m_positionX.data() + i);
+        const auto py = _mm_loadu_ps(m_positionY.data() + i);
+        const auto vx = _mm_loadu_ps(m_velocityX.data() + i);
+        const auto vy = _mm_loadu_ps(m_velocityY.data() + i);
+        const auto impact = _mm_loadu_ps(m_timeToImpact.data() + i);
+        auto best = _mm_set1_epi32(no_launcher);
+        auto best_time = inf;
+        auto best_distance = inf;
+        auto best_x = _mm_setzero_ps();
+        auto best_y = _mm_setzero_ps();
+        for (const auto& candidate : candidates) {
+            const auto t = _mm_set1_ps(candidate.time);
+            const auto aim_x = _mm_add_ps(px, _mm_mul_ps(vx, t));
+            const auto aim_y = _mm_add_ps(py, _mm_mul_ps(vy, t));
+            const auto dx = _mm_sub_ps(aim_x, _mm_set1_ps(candidate.position.x));
+            const auto dy = _mm_sub_ps(aim_y, _mm_set1_ps(candidate.position.y));
+            const auto distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            auto valid = _mm_cmplt_ps(t, impact);
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(aim_x, min_x), _mm_cmple_ps(aim_x, max_x)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(aim_y, min_y), _mm_cmple_ps(aim_y, max_y)));
+            const auto better = _mm_or_ps(_mm_cmplt_ps(t, best_time), _mm_and_ps(_mm_cmpeq_ps(t, best_time), _mm_cmplt_ps(distance, best_distance)));
+            const auto take = _mm_and_ps(valid, better);
+            best = Select(_mm_castps_si128(take), _mm_set1_epi32(candidate.launcher), best);
+            best_time = Select(take, t, best_time);
+            best_distance = Select(take, distance, best_distance);
+            best_x = Select(take, aim_x, best_x);
+            best_y = Select(take, aim_y, best_y);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(m_launcher.data() + i), best);
+        _mm_storeu_ps(m_aimX.data() + i, best_x);
+        _mm_storeu_ps(m_aimY.data() + i, best_y);
+        _mm_storeu_ps(m_interceptTime.data() + i, best_time);
+    }
+#endif
+    for (; i < count; ++i) {
+        auto best = no_launcher;
+        auto best_time = infinity;
+        auto best_distance = infinity;
+        auto best_aim = Vector2{};
+        for (const auto& candidate : candidates) {
+            const auto t = candidate.time;
+            const auto aim = Vector2{ m_positionX[i] + m_velocityX[i] * t, m_positionY[i] + m_velocityY[i] * t };
+            const auto distance = (aim - candidate.position).CalcLengthSquared();
+            const auto valid = t < m_timeToImpact[i] && area.mins.x <= aim.x && aim.x <= area.maxs.x && area.mins.y <= aim.y && aim.y <= area.maxs.y;
+            const auto better = t < best_time || (t == best_time && distance < best_distance);
+            if (valid && better) {
+                best = candidate.launcher;
+                best_time = t;
+                best_distance = distance;
+                best_aim = aim;
+            }
+        }
+        m_launcher[i] = best;
+        m_aimX[i] = best_aim.x;
+        m_aimY[i] = best_aim.y;
+        m_interceptTime[i] = best_time;
+    }
+    m_interceptableCount = static_cast<std::size_t>(std::count_if(m_launcher.begin(), m_launcher.end(), [](std::int32_t launcher) { return launcher != no_launcher; }));
+}
+
+InterceptSolver::Intercept InterceptSolver::GetIntercept(std::size_t threat) const noexcept {
+    if (m_launcher.size() <= threat || m_launcher[threat] == no_launcher) {
+        return Intercept{};
+    }
+    return Intercept{ m_launcher[threat], Vector2{ m_aimX[threat], m_aimY[threat] }, TimeUtils::FPSeconds{ m_interceptTime[threat] } };
+}
+
+TimeUtils::FPSeconds InterceptSolver::GetTimeToImpact(std::size_t threat) const noexcept {
+    return TimeUtils::FPSeconds{ m_timeToImpact[threat] };
+}
+
+std::size_t InterceptSolver::GetInterceptableCount() const noexcept {
+    return m_interceptableCount;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//Picks, for every enemy missile, the base to fire from and the point to aim at so a player explosion catches it.
+//A player missile always takes its base's time to target, so each base offers one candidate per threat:
+//where the threat will be that long from now plus a short lead, which has it fly into the growing explosion.
+//Threats are kept as structure-of-arrays and solved four at a time with SSE2.
+class InterceptSolver {
+public:
+    static constexpr const std::int32_t no_launcher{-1};
+
+    struct Launcher {
+        Vector2 position{};
+        TimeUtils::FPSeconds timeToTarget{};
+        int missilesRemaining{0};
+    };
+    struct Intercept {
+        std::int32_t launcher{no_launcher};
+        Vector2 aim{};
+        //From now until the threat reaches the aim point.
+        TimeUtils::FPSeconds time{};
+    };
+
+    InterceptSolver() = default;
+    InterceptSolver(const InterceptSolver& other) = default;
+    InterceptSolver(InterceptSolver&& other) = default;
+    InterceptSolver& operator=(const InterceptSolver& other) = default;
+    InterceptSolver& operator=(InterceptSolver&& other) = default;
+    ~InterceptSolver() = default;
+
+    void ClearThreats() noexcept;
+    void ReserveThreats(std::size_t count) noexcept;
+    //timeToImpact is how long until the threat reaches its own target; nothing later than that is offered.
+    void AddThreat(Vector2 position, Vector2 velocity, TimeUtils::FPSeconds timeToImpact) noexcept;
+    std::size_t GetThreatCount() const noexcept;
+
+    //Launchers are reported by their index in launchers; those without missiles are skipped.
+    //The earliest intercept whose aim point lies inside area wins, and equal times go to the nearer launcher.
+    //detonationLead is how long after the explosion starts the threat should reach its center.
+    void Solve(std::span<const Launcher> launchers, const AABB2& area, TimeUtils::FPSeconds detonationLead) noexcept;
+
+    //Results of the last Solve, indexed in the order the threats were added.
+    Intercept GetIntercept(std::size_t threat) const noexcept;
+    TimeUtils::FPSeconds GetTimeToImpact(std::size_t threat) const noexcept;
+    std::size_t GetInterceptableCount() const noexcept;
+
+protected:
+private:
+    std::vector<float> m_positionX{};
+    std::vector<float> m_positionY{};
+    std::vector<float> m_velocityX{};
+    std::vector<float> m_velocityY{};
+    std::vector<float> m_timeToImpact{};
+    std::vector<std::int32_t> m_launcher{};
+    std::vector<float> m_aimX{};
+    std::vector<float> m_aimY{};
+    std::vector<float> m_interceptTime{};
+    std::size_t m_interceptableCount{0u};
+};
@@ -4,8 +4,14 @@
 #include "Engine/Platform/Win.hpp"
 
 #include "Game/Game.hpp"
+#include "Game/Headless.hpp"
 
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #pragma warning(push)
 #pragma warning(disable: 28251)
@@ -17,7 +23,20 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
     UNUSED(hInstance);
     UNUSED(hPrevInstance);
     UNUSED(nCmdShow);
-    UNUSED(pCmdLine);
+    auto args = std::vector<std::string>{};
+    std::wistringstream command_line{ pCmdLine != nullptr ? pCmdLine : L"" };
+    for (auto arg = std::wstring{}; command_line >> arg;) {
+        args.push_back(std::filesystem::path{ arg }.string());
+    }
+    //Headless commands report to the console they were started from; a GUI-subsystem process has none of its own.
+    if (!args.empty() && ::AttachConsole(ATTACH_PARENT_PROCESS)) {
+        auto* console = static_cast<std::FILE*>(nullptr);
+        ::freopen_s(&console, "CONOUT$", "w", stdout);
+    }
+    if (const auto exit_code = Headless::Run(args, std::cout); exit_code.has_value()) {
+        std::cout.flush();
+        return *exit_code;
+    }
     Engine<Game>::Initialize("Missile"s);
     Engine<Game>::Run();
     Engine<Game>::Shutdown();
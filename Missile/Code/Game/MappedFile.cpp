@@ -0,0 +1,127 @@
+#include "Game/MappedFile.hpp"
+
+#include <format>
+#include <fstream>
+#include <system_error>
+
+#ifdef _WIN32
+#include "Engine/Platform/Win.hpp"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() noexcept {
+    Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::filesystem::path& path) noexcept {
+    Close();
+    auto* file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        ::CloseHandle(file);
+        return false;
+    }
+    auto* mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        ::CloseHandle(file);
+        return false;
+    }
+    const auto* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const std::byte*>(view);
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() noexcept {
+    if (m_data != nullptr) {
+        ::UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != nullptr) {
+        ::CloseHandle(m_mapping);
+    }
+    if (m_file != nullptr) {
+        ::CloseHandle(m_file);
+    }
+    m_data = nullptr;
+    m_size = 0u;
+    m_mapping = nullptr;
+    m_file = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::filesystem::path& path) noexcept {
+    Close();
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    auto* view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    //The mapping keeps its own reference to the file.
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_data = static_cast<const std::byte*>(view);
+    m_size = static_cast<std::size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::Close() noexcept {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0u;
+}
+
+#endif
+
+bool MappedFile::IsOpen() const noexcept {
+    return m_data != nullptr;
+}
+
+std::span<const std::byte> MappedFile::GetBytes() const noexcept {
+    return std::span<const std::byte>{ m_data, m_size };
+}
+
+bool MappedFile::Write(const std::filesystem::path& path, const std::function<void(std::ostream&)>& write, std::string& error) noexcept {
+    auto temp_path = path;
+    temp_path += ".tmp";
+    {
+        std::ofstream file{ temp_path, std::ios::binary | std::ios::trunc };
+        write(file);
+        if (!file) {
+            error = std::format("cannot write {}", temp_path.string());
+            return false;
+        }
+    }
+    auto ec = std::error_code{};
+    std::filesystem::rename(temp_path, path, ec);
+    if (ec) {
+        error = std::format("cannot replace {}: {}", path.string(), ec.message());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <ostream>
+#include <span>
+#include <string>
+
+//Read-only view of a whole file mapped into memory. Pages are loaded by the OS on first touch.
+//Files meant for it are written with Write. Their layouts are raw structs in host byte order,
+//which is little-endian on every target platform, so they are read in place without conversion.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile& operator=(MappedFile&& other) = delete;
+    ~MappedFile() noexcept;
+
+    //Returns false if the file is missing, empty or cannot be mapped.
+    bool Open(const std::filesystem::path& path) noexcept;
+    void Close() noexcept;
+    bool IsOpen() const noexcept;
+
+    std::span<const std::byte> GetBytes() const noexcept;
+
+    //Runs write against a temporary file next to path, then renames it over path,
+    //so a running game never maps a half-written file. On failure path is untouched and error says why.
+    static bool Write(const std::filesystem::path& path, const std::function<void(std::ostream&)>& write, std::string& error) noexcept;
+
+protected:
+private:
+    const std::byte* m_data{nullptr};
+    std::size_t m_size{0u};
+#ifdef _WIN32
+    void* m_file{nullptr};
+    void* m_mapping{nullptr};
+#endif
+};
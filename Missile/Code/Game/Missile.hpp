@@ -1,55 +1,40 @@
 #pragma once
 
+#include "Engine/Core/Rgba.hpp"
 #include "Engine/Core/TimeUtils.hpp"
 
 #include "Engine/Math/Vector2.hpp"
 
-#include "Engine/Renderer/Mesh.hpp"
-
+#include "Game/EntityRegistry.hpp"
 #include "Game/GameCommon.hpp"
 
-class Missile {
-public:
-
-    Missile() = default;
-    Missile(const Missile& other) = default;
-    Missile(Missile&& other) = default;
-    Missile& operator=(const Missile& other) = default;
-    Missile& operator=(Missile&& other) = default;
-    ~Missile() = default;
-
-    Missile(Vector2 startPosition, Vector2 target, Faction faction, Rgba color) noexcept;
-    Missile(Vector2 startPosition, Vector2 target, TimeUtils::FPSeconds timeToTarget, Faction faction, Rgba color) noexcept;
+#include <random>
 
-    void BeginFrame() noexcept;
-    void Update(TimeUtils::FPSeconds deltaTime) noexcept;
-    void AppendToMesh(Mesh::Builder& builder) noexcept;
-    void EndFrame() noexcept;
+struct RenderSnapshot;
 
-    Vector2 GetPosition() const noexcept;
+struct MissileFlight {
+    Vector2 position{};
+    Vector2 target{};
+    Vector2 startPosition{};
+    TimeUtils::FPSeconds timeToTarget{TimeUtils::FPSeconds{1.0f}};
+    float speed{};
+};
 
-    void SetTarget(Vector2 newTarget) noexcept;
-    Vector2 GetTarget() const noexcept;
-    bool ReachedTarget() const noexcept;
+struct MissileStatus {
+    int health{1};
+    Faction faction{Faction::None};
+};
 
-    void SetColor(Rgba newColor) noexcept;
-    void Kill() noexcept;
-    bool IsDead() const noexcept;
+using MissileArchetype = Archetype<MissileFlight, MissileStatus, Rgba>;
 
-    void SetFaction(Faction newFaction) noexcept;
-    Faction GetFaction() const noexcept;
+namespace MissileSystems {
+    MissileFlight MakeFlight(Vector2 startPosition, Vector2 target, TimeUtils::FPSeconds timeToTarget) noexcept;
 
-protected:
-private:
+    //Moves every live missile toward its target and kills the ones that arrive.
+    void Update(MissileArchetype& missiles, TimeUtils::FPSeconds deltaTime) noexcept;
 
-    Vector2 m_position{};
-    Vector2 m_target{};
-    Vector2 m_startPosition{};
-    Rgba m_color{Rgba::Red};
-    TimeUtils::FPSeconds m_timeToTarget{ TimeUtils::FPSeconds{1.0f} };
-    float m_speed{};
-    int m_health{1};
-    static inline int idx{0};
-    Faction m_faction{Faction::None};
+    //Player missiles draw a target marker colored from markerRng; every missile consumes one color so the sequence does not depend on faction.
+    void AppendToSnapshot(const MissileArchetype& missiles, RenderSnapshot& snapshot, std::mt19937& markerRng) noexcept;
 
-};
+    bool IsDead(const MissileStatus& status) noexcept;
+}
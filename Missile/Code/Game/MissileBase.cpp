@@ -4,15 +4,23 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Rgba.hpp"
 
-#include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 
 #include "Game/Game.hpp"
+#include "Game/RenderSnapshot.hpp"
 
 #include <utility>
 
-MissileBase::MissileBase(Vector2 position) noexcept
-    : m_position{position}
+MissileBase::MissileBase(GameStateMain* world) noexcept
+    : MissileBase{world, Vector2::Zero}
+{
+    /* DO NOTHING */
+}
+
+MissileBase::MissileBase(GameStateMain* world, Vector2 position) noexcept
+    : m_world{world}
+    , m_position{position}
+    , m_missileManager{world}
     , m_missilesRemaining{m_maxMissiles}
 {
     /* DO NOTHING */
@@ -26,6 +34,10 @@ void MissileBase::SetTimeToTarget(TimeUtils::FPSeconds newTimeToTarget) noexcept
     m_timeToTarget = newTimeToTarget;
 }
 
+TimeUtils::FPSeconds MissileBase::GetTimeToTarget() const noexcept {
+    return m_timeToTarget;
+}
+
 void MissileBase::BeginFrame() noexcept {
     m_missileManager.BeginFrame();
 }
@@ -34,43 +46,9 @@ void MissileBase::Update([[maybe_unused]] TimeUtils::FPSeconds deltaSeconds) noe
     m_missileManager.Update(deltaSeconds);
 }
 
-void MissileBase::Render() const noexcept {
-    g_theRenderer->SetModelMatrix();
-    g_theRenderer->SetMaterial("__2D");
-
-    {
-        auto* mat = g_theRenderer->GetMaterial("base");
-        auto* tex = mat->GetTexture(Material::TextureID::Diffuse);
-        const auto&& [x, y, _] = tex->GetDimensions().GetXYZ();
-        const auto dims = IntVector2{ x, y };
-        const auto S = Matrix4::CreateScaleMatrix(Vector2{ dims });
-        const auto R = Matrix4::I;
-        const auto T = Matrix4::CreateTranslationMatrix(m_position);
-        const auto M = Matrix4::MakeSRT(S, R, T);
-        g_theRenderer->SetMaterial(mat);
-        g_theRenderer->DrawQuad2D(M, GetBaseColor());
-    }
-    m_missileManager.Render();
-
-    if(HasMissilesRemaining()) {
-        RenderRemainingMissiles();
-    }
-
-    if (OutOfMissiles()) {
-        const auto* font = g_theRenderer->GetFont("System32");
-        const auto S = Matrix4::I;
-        const auto R = Matrix4::I;
-        const auto T = Matrix4::CreateTranslationMatrix(m_position + Vector2{-0.5f * font->CalculateTextWidth("OUT"), 24.0f});
-        const auto M = Matrix4::MakeSRT(S, R, T);
-        g_theRenderer->DrawTextLine(M, font, "OUT", GetMissileColor());
-    } else if(LowOnMissiles()) {
-        const auto* font = g_theRenderer->GetFont("System32");
-        const auto S = Matrix4::I;
-        const auto R = Matrix4::I;
-        const auto T = Matrix4::CreateTranslationMatrix(m_position + Vector2{-0.5f * font->CalculateTextWidth("LOW"), 24.0f});
-        const auto M = Matrix4::MakeSRT(S, R, T);
-        g_theRenderer->DrawTextLine(M, font, "LOW", GetMissileColor());
-    }
+void MissileBase::AppendToSnapshot(RenderSnapshot& snapshot) noexcept {
+    snapshot.bases.push_back(RenderSnapshot::Base{m_position, GetBaseColor(), GetMissileColor(), m_missilesRemaining});
+    m_missileManager.AppendToSnapshot(snapshot);
 }
 
 void MissileBase::DebugRender() const noexcept {
@@ -88,11 +66,11 @@ void MissileBase::Fire(MissileManager::Target target) noexcept {
         if(m_missileManager.LaunchMissile(GetMissileLauncherPosition(), target, m_timeToTarget, Faction::Player, GetMissileColor())) {
             DecrementMissiles();
             if(m_missilesRemaining == 3) {
-                g_theAudioSystem->Play(GameConstants::game_audio_lowmissiles_path, AudioSystem::SoundDesc{.loopCount = 3, .stopWhenFinishedLooping = true});
+                m_world->PublishEvent(GameEvent{GameEventType::LowMissiles, Faction::Player, m_position, m_missilesRemaining});
             }
         }
     } else {
-        g_theAudioSystem->Play(GameConstants::game_audio_nomissiles_path, AudioSystem::SoundDesc{});
+        m_world->PublishEvent(GameEvent{GameEventType::OutOfMissiles, Faction::Player, m_position, 0});
     }
 }
 
@@ -105,19 +83,19 @@ bool MissileBase::OutOfMissiles() const noexcept {
 }
 
 bool MissileBase::LowOnMissiles() const noexcept {
-    return m_missilesRemaining < 4;
+    return m_missilesRemaining < GameConstants::low_missile_count;
 }
 
 void MissileBase::DecrementMissiles() noexcept {
-    m_missilesRemaining = (std::max)(0, m_missilesRemaining - 1);
+    SetMissilesRemaining((std::max)(0, m_missilesRemaining - 1));
 }
 
 void MissileBase::IncrementMissiles() noexcept {
-    m_missilesRemaining = (std::min)(m_maxMissiles, m_missilesRemaining + 1);
+    SetMissilesRemaining((std::min)(m_maxMissiles, m_missilesRemaining + 1));
 }
 
 void MissileBase::ResetMissiles() noexcept {
-    m_missilesRemaining = m_maxMissiles;
+    SetMissilesRemaining(m_maxMissiles);
 }
 
 int MissileBase::GetMissilesRemaining() const noexcept {
@@ -133,49 +111,23 @@ MissileManager& MissileBase::GetMissileManager() noexcept {
 }
 
 void MissileBase::RemoveAllMissiles() noexcept {
-    m_missilesRemaining = 0;
-}
-
-void MissileBase::RenderRemainingMissiles() const noexcept {
-    auto* mat = g_theRenderer->GetMaterial("missile");
-    const auto* tex = mat->GetTexture(Material::TextureID::Diffuse);
-    const auto dims = Vector2{ IntVector2{tex->GetDimensions()} };
-    const auto S = Matrix4::CreateScaleMatrix(dims);
-    const auto R = Matrix4::I;
-    const auto position = Vector2{m_position.x, m_position.y + dims.y};
-    const auto missilePositions = std::vector<Vector2>{
-         position + Vector2{ 2.0f * dims.x, dims.y }
-        ,position + Vector2{ dims.x, dims.y }
-        ,position + Vector2{ -dims.x, dims.y }
-        ,position + Vector2{ -2.0f * dims.x, dims.y }
-        ,position + Vector2::X_Axis * dims.x
-        ,position
-        ,position - Vector2::X_Axis * dims.x
-        ,position - Vector2{ dims.x * -0.5f, dims.y }
-        ,position - Vector2{ dims.x * 0.5f, dims.y }
-        ,position - (Vector2::Y_Axis * dims.y * 2.0f)
-    };
-    g_theRenderer->SetMaterial(mat);
-    const auto s = missilePositions.size();
-    const auto idx = s - m_missilesRemaining;
-    const auto color = GetMissileColor();
-    for (std::size_t i = idx; i < s; ++i) {
-        const auto T = Matrix4::CreateTranslationMatrix(missilePositions[i]);
-        const auto M = Matrix4::MakeSRT(S, R, T);
-        g_theRenderer->DrawQuad2D(M, color);
+    SetMissilesRemaining(0);
+}
+
+void MissileBase::SetMissilesRemaining(int count) noexcept {
+    //Enemies only aim at bases that still have missiles.
+    if ((count == 0) != (m_missilesRemaining == 0)) {
+        m_world->InvalidateTargets();
     }
+    m_missilesRemaining = count;
 }
 
 Rgba MissileBase::GetMissileColor() const noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-    return Rgba(GameConstants::wave_player_color_lookup[state->GetWaveId() % GameConstants::wave_array_size]);
+    return m_world->GetPlayerColor();
 }
 
 Rgba MissileBase::GetBaseColor() const noexcept {
-    auto* g = GetGameAs<Game>();
-    auto* state = dynamic_cast<GameStateMain*>(g->GetCurrentState());
-    return Rgba(GameConstants::wave_ground_color_lookup[state->GetWaveId() % GameConstants::wave_array_size]);
+    return m_world->GetGroundColor();
 }
 
 Vector2 MissileBase::GetMissileLauncherPosition() const noexcept {
@@ -187,5 +139,8 @@ AABB2 MissileBase::GetCollisionMesh() const noexcept {
 }
 
 void MissileBase::Kill() noexcept {
+    if (m_missilesRemaining != 0) {
+        m_world->InvalidateStaticScene();
+    }
     RemoveAllMissiles();
 }
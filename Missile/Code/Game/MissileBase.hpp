@@ -2,26 +2,33 @@
 
 #include "Engine/Core/TimeUtils.hpp"
 
+#include "Engine/Math/AABB2.hpp"
+
 #include "Game/MissileManager.hpp"
 
+class GameStateMain;
+struct RenderSnapshot;
+
 class MissileBase {
 public:
 
-    MissileBase() = default;
+    MissileBase() = delete;
     MissileBase(const MissileBase& other) = default;
     MissileBase(MissileBase&& other) = default;
     MissileBase& operator=(const MissileBase& other) = default;
     MissileBase& operator=(MissileBase&& other) = default;
     ~MissileBase() = default;
 
-    explicit MissileBase(Vector2 position) noexcept;
+    explicit MissileBase(GameStateMain* world) noexcept;
+    MissileBase(GameStateMain* world, Vector2 position) noexcept;
 
     void SetPosition(Vector2 position) noexcept;
     void SetTimeToTarget(TimeUtils::FPSeconds newTimeToTarget) noexcept;
+    TimeUtils::FPSeconds GetTimeToTarget() const noexcept;
 
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -47,13 +54,14 @@ public:
 protected:
 private:
 
-    void RenderRemainingMissiles() const noexcept;
+    void SetMissilesRemaining(int count) noexcept;
     Rgba GetMissileColor() const noexcept;
     Rgba GetBaseColor() const noexcept;
 
+    GameStateMain* m_world{nullptr};
     Vector2 m_position{};
-    MissileManager m_missileManager{};
+    MissileManager m_missileManager;
     TimeUtils::FPSeconds m_timeToTarget{ 1.0f };
-    int m_maxMissiles{10};
+    int m_maxMissiles{GameConstants::max_base_missile_count};
     int m_missilesRemaining{m_maxMissiles};
 };
@@ -4,35 +4,27 @@
 
 #include "Engine/Renderer/Renderer.hpp"
 
-#include <algorithm>
+#include "Game/GameStateMain.hpp"
+#include "Game/InterceptSolver.hpp"
+#include "Game/RenderSnapshot.hpp"
+
+MissileManager::MissileManager(GameStateMain* world) noexcept
+    : m_world{world}
+{
+    /* DO NOTHING */
+}
 
 void MissileManager::BeginFrame() noexcept {
-    m_builder.Clear();
-    if(m_deadMissiles.size() < m_missiles.size()) {
-        m_deadMissiles.reserve(static_cast<std::size_t>(std::ceil(1.5f * (m_deadMissiles.size() + m_missiles.size()))));
-    }
-    for (auto& m : m_missiles) {
-        m.BeginFrame();
-    }
+    /* DO NOTHING */
 }
 
 void MissileManager::Update(TimeUtils::FPSeconds deltaSeconds) noexcept {
-    for (auto& m : m_missiles) {
-        m.Update(deltaSeconds);
-    }
-    for (auto& m : m_missiles) {
-        m.AppendToMesh(m_builder);
-    }
-    for (std::size_t i = 0u; i < m_missiles.size(); ++i) {
-        if (m_missiles[i].IsDead()) {
-            m_deadMissiles.push_back(i);
-        }
-    }
+    MissileSystems::Update(m_missiles, deltaSeconds);
 }
 
-void MissileManager::Render() const noexcept {
-    g_theRenderer->SetModelMatrix();
-    Mesh::Render(m_builder);
+void MissileManager::AppendToSnapshot(RenderSnapshot& snapshot) noexcept {
+    //Each manager owns its marker generator so missile capture never touches the shared engine RNG.
+    MissileSystems::AppendToSnapshot(m_missiles, snapshot, m_markerRng);
 }
 
 void MissileManager::DebugRender() const noexcept {
@@ -40,15 +32,18 @@ void MissileManager::DebugRender() const noexcept {
 }
 
 void MissileManager::EndFrame() noexcept {
-    for (auto& m : m_missiles) {
-        m.EndFrame();
+    const auto& flights = m_missiles.Column<MissileFlight>();
+    const auto& statuses = m_missiles.Column<MissileStatus>();
+    for (std::size_t i = 0u; i < m_missiles.Size(); ++i) {
+        if (MissileSystems::IsDead(statuses[i])) {
+            m_world->CreateExplosionAt(flights[i].position, statuses[i].faction);
+        }
     }
-    std::sort(std::begin(m_deadMissiles), std::end(m_deadMissiles), std::greater<std::size_t>());
-    for (const auto& i : m_deadMissiles) {
-        std::swap(m_missiles[i], m_missiles.back());
-        m_missiles.pop_back();
+    for (auto i = m_missiles.Size(); i-- > 0u;) {
+        if (MissileSystems::IsDead(statuses[i])) {
+            m_missiles.DestroyAt(i);
+        }
     }
-    m_deadMissiles.clear();
 }
 
 bool MissileManager::LaunchMissile(Vector2 position, Direction direction, TimeUtils::FPSeconds timeToTarget, Faction faction, Rgba color) noexcept {
@@ -56,27 +51,33 @@ bool MissileManager::LaunchMissile(Vector2 position, Direction direction, TimeUt
 }
 
 bool MissileManager::LaunchMissile(Vector2 position, Target target, TimeUtils::FPSeconds timeToTarget, Faction faction, Rgba color) noexcept {
-    m_missiles.emplace_back( position, target.value, timeToTarget, faction, color );
+    m_missiles.Create(MissileSystems::MakeFlight(position, target.value, timeToTarget), MissileStatus{1, faction}, color);
+    m_world->PublishEvent(GameEvent{GameEventType::MissileLaunched, faction, position, 0});
     return true;
 }
 
 std::size_t MissileManager::ActiveMissileCount() const noexcept {
-    return m_missiles.size();
+    return m_missiles.Size();
 }
 
 std::vector<Vector2> MissileManager::GetMissilePositions() const noexcept {
     std::vector<Vector2> results;
-    results.reserve(m_missiles.size());
-    for(const auto& m : m_missiles) {
-        results.push_back(m.GetPosition());
+    results.reserve(m_missiles.Size());
+    for (const auto& flight : m_missiles.Column<MissileFlight>()) {
+        results.push_back(flight.position);
     }
     return results;
 }
 
+void MissileManager::AppendThreats(InterceptSolver& solver) const noexcept {
+    m_missiles.Each<MissileFlight, MissileStatus>([&solver](const MissileFlight& flight, const MissileStatus& status) {
+        if (MissileSystems::IsDead(status) || flight.timeToTarget <= TimeUtils::FPSeconds::zero()) {
+            return;
+        }
+        solver.AddThreat(flight.position, (flight.target - flight.position).GetNormalize() * flight.speed, flight.timeToTarget);
+    });
+}
+
 void MissileManager::KillMissile(std::size_t idx) noexcept {
-    if(std::find(std::cbegin(m_deadMissiles), std::cend(m_deadMissiles), idx) == std::cend(m_deadMissiles)) {
-        auto& m = *(std::begin(m_missiles) + idx);
-        m.Kill();
-        m_deadMissiles.push_back(idx);
-    }
+    m_missiles.Column<MissileStatus>()[idx].health = 0;
 }
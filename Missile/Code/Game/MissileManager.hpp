@@ -2,16 +2,23 @@
 
 #include "Engine/Core/TimeUtils.hpp"
 #include "Engine/Math/Vector2.hpp"
-#include "Engine/Renderer/Mesh.hpp"
 
 #include "Game/GameCommon.hpp"
 #include "Game/Missile.hpp"
 
+#include <random>
 #include <vector>
 
+class GameStateMain;
+class InterceptSolver;
+struct RenderSnapshot;
+
 class MissileManager {
 public:
 
+    MissileManager() = delete;
+    explicit MissileManager(GameStateMain* world) noexcept;
+
     struct Direction {
         Vector2 value;
     };
@@ -21,7 +28,7 @@ public:
 
     void BeginFrame() noexcept;
     void Update(TimeUtils::FPSeconds deltaSeconds) noexcept;
-    void Render() const noexcept;
+    void AppendToSnapshot(RenderSnapshot& snapshot) noexcept;
     void DebugRender() const noexcept;
     void EndFrame() noexcept;
 
@@ -30,12 +37,15 @@ public:
 
     std::size_t ActiveMissileCount() const noexcept;
     std::vector<Vector2> GetMissilePositions() const noexcept;
+    //Adds every live missile in flight as a threat to be intercepted.
+    void AppendThreats(InterceptSolver& solver) const noexcept;
     void KillMissile(std::size_t idx) noexcept;
 
 protected:
 private:
+
     Vector2 m_position{};
-    std::vector<Missile> m_missiles{};
-    std::vector<std::size_t> m_deadMissiles{};
-    mutable Mesh::Builder m_builder{};
+    GameStateMain* m_world{nullptr};
+    MissileArchetype m_missiles{};
+    std::mt19937 m_markerRng{std::random_device{}()};
 };
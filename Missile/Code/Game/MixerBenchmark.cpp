@@ -0,0 +1,113 @@
+#include "Game/MixerBenchmark.hpp"
+
+#include "Game/GameCommon.hpp"
+#include "Game/NullAudioDevice.hpp"
+#include "Game/SoftwareMixer.hpp"
+#include "Game/SoundBank.hpp"
+#include "Game/SoundBoard.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct ChainReaction {
+        std::array<const SoundClip*, SoundBoard::sound_count> clips{};
+        std::array<std::deque<SoftwareMixer::VoiceId>, SoundBoard::sound_count> voices{};
+        std::size_t voiceScale{1u};
+    };
+
+    ChainReaction MakeChainReaction(const SoundBank& bank, std::size_t voiceScale) noexcept {
+        auto reaction = ChainReaction{};
+        reaction.voiceScale = voiceScale;
+        for (std::size_t i = 0u; i < SoundBoard::sound_count; ++i) {
+            reaction.clips[i] = bank.Find(SoundBoard::GetClipName(static_cast<SoundId>(i)));
+        }
+        return reaction;
+    }
+
+    //One game frame of the chain reaction: every sound starts a voice, stopping its oldest once it is at its cap.
+    void StartFrame(ChainReaction& reaction, SoftwareMixer& mixer) noexcept {
+        for (std::size_t i = 0u; i < SoundBoard::sound_count; ++i) {
+            const auto* clip = reaction.clips[i];
+            if (clip == nullptr) {
+                continue;
+            }
+            const auto id = static_cast<SoundId>(i);
+            auto& sound_voices = reaction.voices[i];
+            if (sound_voices.size() >= SoundBoard::GetMaxVoices(id) * reaction.voiceScale) {
+                mixer.Stop(sound_voices.front());
+                sound_voices.pop_front();
+            }
+            //A chain reaction merges many explosions per frame, so they play at the merge ceiling.
+            const auto volume = id == SoundId::Explosion ? GameConstants::sound_max_merged_volume : 1.0f;
+            if (const auto voice = mixer.Start(*clip, volume, 1.0f, 0); voice != SoftwareMixer::invalid_voice) {
+                sound_voices.push_back(voice);
+            }
+        }
+    }
+}
+
+MixerBenchmark::Result MixerBenchmark::Run(const SoundBank& bank, std::uint32_t outputRate, std::size_t voiceScale, std::size_t blockCount) noexcept {
+    SoftwareMixer mixer{ outputRate };
+    auto reaction = MakeChainReaction(bank, voiceScale);
+    auto buffer = std::array<float, SoftwareMixer::block_samples>{};
+    auto block_times = std::vector<float>{};
+    block_times.reserve(blockCount);
+    const auto block_seconds = mixer.GetBlockDuration().count();
+    auto until_frame = 0.0f;
+    for (std::size_t block = 0u; block < blockCount; ++block) {
+        if (until_frame <= 0.0f) {
+            until_frame += GameConstants::mixer_benchmark_frame_seconds;
+            StartFrame(reaction, mixer);
+        }
+        until_frame -= block_seconds;
+        mixer.MixBlock(buffer);
+        block_times.push_back(mixer.GetStats().lastBlock.count());
+    }
+
+    const auto stats = mixer.GetStats();
+    auto result = Result{};
+    result.voices = stats.peakVoices;
+    result.blocks = block_times.size();
+    if (block_times.empty()) {
+        return result;
+    }
+    std::sort(block_times.begin(), block_times.end());
+    result.average = stats.totalTime / static_cast<float>(block_times.size());
+    result.p99 = TimeUtils::FPMicroseconds{ block_times[(std::min)(block_times.size() - 1u, block_times.size() * 99u / 100u)] };
+    result.max = stats.maxBlock;
+    if (result.average.count() > 0.0f) {
+        result.realtimeFactor = TimeUtils::FPMicroseconds{ mixer.GetBlockDuration() }.count() / result.average.count();
+    }
+    return result;
+}
+
+MixerBenchmark::PacedResult MixerBenchmark::RunPaced(const SoundBank& bank, std::uint32_t outputRate, TimeUtils::FPSeconds duration) noexcept {
+    SoftwareMixer mixer{ outputRate };
+    auto reaction = MakeChainReaction(bank, 1u);
+    auto result = PacedResult{};
+    {
+        NullAudioDevice device{};
+        device.Start(mixer);
+        const auto frame = std::chrono::duration_cast<std::chrono::steady_clock::duration>(TimeUtils::FPSeconds{ GameConstants::mixer_benchmark_frame_seconds });
+        const auto end = TimeUtils::Now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration);
+        for (auto next = TimeUtils::Now(); next < end; next += frame) {
+            StartFrame(reaction, mixer);
+            std::this_thread::sleep_until(next + frame);
+        }
+        device.Stop();
+        result.blocks = device.GetBlockCount();
+        result.underruns = device.GetUnderrunCount();
+    }
+    const auto stats = mixer.GetStats();
+    result.voices = stats.peakVoices;
+    result.max = stats.maxBlock;
+    if (stats.blocks != 0u) {
+        result.average = stats.totalTime / static_cast<float>(stats.blocks);
+    }
+    return result;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+class SoundBank;
+
+//Times the software mixer under the heaviest load gameplay produces: a stress-mode chain reaction that holds
+//every sound at its voice cap and steals the oldest voice of each one every frame.
+//Needs only the sound bank, so it runs from Headless without the engine or a sound card.
+namespace MixerBenchmark {
+    struct Result {
+        std::size_t voices{0u};
+        std::size_t blocks{0u};
+        TimeUtils::FPMicroseconds average{};
+        TimeUtils::FPMicroseconds p99{};
+        TimeUtils::FPMicroseconds max{};
+        //Seconds of audio mixed per second spent mixing.
+        float realtimeFactor{0.0f};
+    };
+    struct PacedResult {
+        std::size_t voices{0u};
+        std::uint64_t blocks{0u};
+        std::uint64_t underruns{0u};
+        TimeUtils::FPMicroseconds average{};
+        TimeUtils::FPMicroseconds max{};
+    };
+
+    //Mixes blockCount blocks back to back. voiceScale multiplies every voice cap, to see how far the caps could be raised.
+    Result Run(const SoundBank& bank, std::uint32_t outputRate, std::size_t voiceScale, std::size_t blockCount) noexcept;
+    //Mixes in real time on a NullAudioDevice while this thread starts the voices once per game frame, as the game does,
+    //so the mix thread has to keep up with voices arriving from another thread.
+    PacedResult RunPaced(const SoundBank& bank, std::uint32_t outputRate, TimeUtils::FPSeconds duration) noexcept;
+}
@@ -0,0 +1,58 @@
+#include "Game/NullAudioDevice.hpp"
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Game/SoftwareMixer.hpp"
+
+#include <array>
+#include <chrono>
+
+NullAudioDevice::~NullAudioDevice() noexcept {
+    Stop();
+}
+
+void NullAudioDevice::Start(SoftwareMixer& mixer) noexcept {
+    Stop();
+    m_blocks = 0u;
+    m_underruns = 0u;
+    m_thread = std::jthread([this, &mixer](std::stop_token stopToken) { this->DeviceLoop(stopToken, mixer); });
+}
+
+void NullAudioDevice::Stop() noexcept {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    m_thread.request_stop();
+    m_thread.join();
+}
+
+bool NullAudioDevice::IsRunning() const noexcept {
+    return m_thread.joinable();
+}
+
+std::uint64_t NullAudioDevice::GetBlockCount() const noexcept {
+    return m_blocks.load(std::memory_order_relaxed);
+}
+
+std::uint64_t NullAudioDevice::GetUnderrunCount() const noexcept {
+    return m_underruns.load(std::memory_order_relaxed);
+}
+
+void NullAudioDevice::DeviceLoop(std::stop_token stopToken, SoftwareMixer& mixer) noexcept {
+    auto buffer = std::array<float, SoftwareMixer::block_samples>{};
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(mixer.GetBlockDuration());
+    auto deadline = TimeUtils::Now() + period;
+    while (!stopToken.stop_requested()) {
+        mixer.MixBlock(buffer);
+        ++m_blocks;
+        const auto now = TimeUtils::Now();
+        if (now > deadline) {
+            //A real device would have played silence; start the next block's deadline from here.
+            ++m_underruns;
+            deadline = now + period;
+            continue;
+        }
+        std::this_thread::sleep_until(deadline);
+        deadline += period;
+    }
+}
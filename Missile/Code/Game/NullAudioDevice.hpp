@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <stop_token>
+#include <thread>
+
+class SoftwareMixer;
+
+//Drives the software mixer without a sound card so the mixer path can be exercised and timed.
+//The game plays the mixer through WaveOutDevice; this device is for timing the mixer where nothing needs to be heard.
+//Pulls one block at a time from the mixer at the mixer's output rate and discards it.
+//A block whose mix finishes after its deadline would have been an audible gap, so it is counted as an underrun.
+class NullAudioDevice {
+public:
+    NullAudioDevice() = default;
+    NullAudioDevice(const NullAudioDevice& other) = delete;
+    NullAudioDevice(NullAudioDevice&& other) = delete;
+    NullAudioDevice& operator=(const NullAudioDevice& other) = delete;
+    NullAudioDevice& operator=(NullAudioDevice&& other) = delete;
+    ~NullAudioDevice() noexcept;
+
+    //The mixer must outlive the device or the next Stop.
+    void Start(SoftwareMixer& mixer) noexcept;
+    void Stop() noexcept;
+    bool IsRunning() const noexcept;
+
+    std::uint64_t GetBlockCount() const noexcept;
+    std::uint64_t GetUnderrunCount() const noexcept;
+
+protected:
+private:
+    void DeviceLoop(std::stop_token stopToken, SoftwareMixer& mixer) noexcept;
+
+    std::atomic<std::uint64_t> m_blocks{0u};
+    std::atomic<std::uint64_t> m_underruns{0u};
+    std::jthread m_thread{};
+};
@@ -0,0 +1,201 @@
+#include "Game/PngFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace {
+    constexpr const std::array<unsigned char, 8> png_signature{ 0x89u, 'P', 'N', 'G', '\r', '\n', 0x1Au, '\n' };
+    constexpr const std::size_t max_stored_block{65535u};
+
+    constexpr const std::array<std::uint32_t, 256> crc_table = []() {
+        auto table = std::array<std::uint32_t, 256>{};
+        for (std::uint32_t n = 0u; n < 256u; ++n) {
+            auto c = n;
+            for (int k = 0; k < 8; ++k) {
+                c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+        return table;
+    }();
+
+    std::uint32_t UpdateCrc(std::uint32_t crc, const unsigned char* data, std::size_t size) noexcept {
+        for (std::size_t i = 0u; i < size; ++i) {
+            crc = crc_table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    std::uint32_t CalcAdler32(const unsigned char* data, std::size_t size) noexcept {
+        constexpr const std::uint32_t modulus{65521u};
+        //5552 is the largest run that cannot overflow 32 bits before taking the modulus.
+        constexpr const std::size_t max_run{5552u};
+        auto a = std::uint32_t{1u};
+        auto b = std::uint32_t{0u};
+        while (size != 0u) {
+            const auto run = (std::min)(size, max_run);
+            for (std::size_t i = 0u; i < run; ++i) {
+                a += data[i];
+                b += a;
+            }
+            a %= modulus;
+            b %= modulus;
+            data += run;
+            size -= run;
+        }
+        return (b << 16) | a;
+    }
+
+    void AppendBigEndian(std::vector<unsigned char>& out, std::uint32_t value) noexcept {
+        out.push_back(static_cast<unsigned char>(value >> 24));
+        out.push_back(static_cast<unsigned char>(value >> 16));
+        out.push_back(static_cast<unsigned char>(value >> 8));
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    std::uint32_t ReadBigEndian(const unsigned char* bytes) noexcept {
+        return (std::uint32_t{bytes[0]} << 24) | (std::uint32_t{bytes[1]} << 16) | (std::uint32_t{bytes[2]} << 8) | std::uint32_t{bytes[3]};
+    }
+
+    void AppendChunk(std::vector<unsigned char>& out, const char (&type)[5], const unsigned char* data, std::size_t size) noexcept {
+        AppendBigEndian(out, static_cast<std::uint32_t>(size));
+        const auto type_start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data, data + size);
+        const auto crc = UpdateCrc(0xFFFFFFFFu, out.data() + type_start, size + 4u) ^ 0xFFFFFFFFu;
+        AppendBigEndian(out, crc);
+    }
+
+    void Encode(const std::vector<std::uint32_t>& pixels, int width, int height, PngFile::Scratch& scratch) noexcept {
+        auto& scanlines = scratch.scanlines;
+        const auto row_size = static_cast<std::size_t>(width) * 3u + 1u;
+        scanlines.resize(row_size * static_cast<std::size_t>(height));
+        for (int y = 0; y < height; ++y) {
+            auto* row = scanlines.data() + row_size * static_cast<std::size_t>(y);
+            const auto* src = pixels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+            *row++ = 0u;
+            for (int x = 0; x < width; ++x) {
+                const auto p = src[x];
+                row[0] = static_cast<unsigned char>(p);
+                row[1] = static_cast<unsigned char>(p >> 8);
+                row[2] = static_cast<unsigned char>(p >> 16);
+                row += 3;
+            }
+        }
+
+        auto& zlib = scratch.zlib;
+        zlib.clear();
+        zlib.reserve(scanlines.size() + (scanlines.size() / max_stored_block + 1u) * 5u + 6u);
+        zlib.push_back(0x78u);
+        zlib.push_back(0x01u);
+        for (std::size_t offset = 0u; offset < scanlines.size(); offset += max_stored_block) {
+            const auto length = (std::min)(max_stored_block, scanlines.size() - offset);
+            const auto is_final = offset + length == scanlines.size();
+            zlib.push_back(is_final ? 1u : 0u);
+            zlib.push_back(static_cast<unsigned char>(length));
+            zlib.push_back(static_cast<unsigned char>(length >> 8));
+            zlib.push_back(static_cast<unsigned char>(~length));
+            zlib.push_back(static_cast<unsigned char>(~length >> 8));
+            zlib.insert(zlib.end(), scanlines.begin() + offset, scanlines.begin() + offset + length);
+        }
+        AppendBigEndian(zlib, CalcAdler32(scanlines.data(), scanlines.size()));
+
+        auto& out = scratch.encoded;
+        out.clear();
+        out.insert(out.end(), png_signature.begin(), png_signature.end());
+        auto header = std::vector<unsigned char>{};
+        AppendBigEndian(header, static_cast<std::uint32_t>(width));
+        AppendBigEndian(header, static_cast<std::uint32_t>(height));
+        header.insert(header.end(), { 8u, 2u, 0u, 0u, 0u });
+        AppendChunk(out, "IHDR", header.data(), header.size());
+        AppendChunk(out, "IDAT", zlib.data(), zlib.size());
+        AppendChunk(out, "IEND", nullptr, 0u);
+    }
+
+    //Unwraps the zlib stream Encode writes: stored blocks only, each with its header in a byte of its own.
+    bool Inflate(const std::vector<unsigned char>& zlib, std::vector<unsigned char>& out) noexcept {
+        if (zlib.size() < 6u || (zlib[0] & 0x0Fu) != 8u || ((zlib[0] << 8) | zlib[1]) % 31 != 0) {
+            return false;
+        }
+        auto pos = std::size_t{2u};
+        for (auto is_final = false; !is_final;) {
+            if (zlib.size() < pos + 5u || (zlib[pos] & 0x06u) != 0u) {
+                return false;
+            }
+            is_final = (zlib[pos] & 0x01u) != 0u;
+            const auto length = static_cast<std::size_t>(zlib[pos + 1] | (zlib[pos + 2] << 8));
+            const auto inverse = static_cast<std::size_t>(zlib[pos + 3] | (zlib[pos + 4] << 8));
+            pos += 5u;
+            if ((length ^ 0xFFFFu) != inverse || zlib.size() < pos + length) {
+                return false;
+            }
+            out.insert(out.end(), zlib.begin() + pos, zlib.begin() + pos + length);
+            pos += length;
+        }
+        return zlib.size() >= pos + 4u && ReadBigEndian(zlib.data() + pos) == CalcAdler32(out.data(), out.size());
+    }
+}
+
+bool PngFile::Write(const std::filesystem::path& path, const std::vector<std::uint32_t>& pixels, int width, int height, Scratch& scratch) noexcept {
+    Encode(pixels, width, height, scratch);
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+    file.write(reinterpret_cast<const char*>(scratch.encoded.data()), static_cast<std::streamsize>(scratch.encoded.size()));
+    return static_cast<bool>(file);
+}
+
+bool PngFile::Read(const std::filesystem::path& path, std::vector<std::uint32_t>& pixels, int& width, int& height) noexcept {
+    pixels.clear();
+    std::ifstream file{ path, std::ios::binary };
+    const auto bytes = std::vector<unsigned char>{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+    if (bytes.size() < png_signature.size() || !std::equal(png_signature.begin(), png_signature.end(), bytes.begin())) {
+        return false;
+    }
+    auto zlib = std::vector<unsigned char>{};
+    auto image_width = std::uint32_t{0u};
+    auto image_height = std::uint32_t{0u};
+    for (std::size_t pos = png_signature.size(); pos + 12u <= bytes.size();) {
+        const auto size = static_cast<std::size_t>(ReadBigEndian(bytes.data() + pos));
+        const auto* type = bytes.data() + pos + 4u;
+        const auto* data = type + 4;
+        if (bytes.size() - pos - 12u < size || ReadBigEndian(data + size) != (UpdateCrc(0xFFFFFFFFu, type, size + 4u) ^ 0xFFFFFFFFu)) {
+            return false;
+        }
+        if (std::memcmp(type, "IHDR", 4) == 0) {
+            constexpr const std::array<unsigned char, 5> rgb8{ 8u, 2u, 0u, 0u, 0u };
+            if (size != 13u || !std::equal(rgb8.begin(), rgb8.end(), data + 8)) {
+                return false;
+            }
+            image_width = ReadBigEndian(data);
+            image_height = ReadBigEndian(data + 4);
+        } else if (std::memcmp(type, "IDAT", 4) == 0) {
+            zlib.insert(zlib.end(), data, data + size);
+        } else if (std::memcmp(type, "IEND", 4) == 0) {
+            break;
+        }
+        pos += size + 12u;
+    }
+    auto scanlines = std::vector<unsigned char>{};
+    const auto row_size = std::size_t{image_width} * 3u + 1u;
+    if (image_width == 0u || image_height == 0u || !Inflate(zlib, scanlines) || scanlines.size() != row_size * image_height) {
+        return false;
+    }
+    pixels.resize(std::size_t{image_width} * image_height);
+    for (std::size_t y = 0u; y < image_height; ++y) {
+        const auto* row = scanlines.data() + row_size * y;
+        //Write never filters, so any other filter type means another encoder produced the file.
+        if (*row++ != 0u) {
+            pixels.clear();
+            return false;
+        }
+        auto* dst = pixels.data() + std::size_t{image_width} * y;
+        for (std::size_t x = 0u; x < image_width; ++x, row += 3) {
+            dst[x] = std::uint32_t{row[0]} | (std::uint32_t{row[1]} << 8) | (std::uint32_t{row[2]} << 16) | 0xFF000000u;
+        }
+    }
+    width = static_cast<int>(image_width);
+    height = static_cast<int>(image_height);
+    return true;
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+//8-bit RGB PNG with the image data in stored deflate blocks: encoding is bandwidth-bound and the files are meant
+//for conversion to video or for pixel comparison, not for archiving. Read only accepts files written by Write.
+//Pixels are RGBA8 packed with red in the lowest byte, rows top to bottom. Alpha is not written and reads back opaque.
+namespace PngFile {
+    //Buffers reused between writes so an encoder thread does not allocate per frame.
+    struct Scratch {
+        std::vector<unsigned char> scanlines{};
+        std::vector<unsigned char> zlib{};
+        std::vector<unsigned char> encoded{};
+    };
+
+    bool Write(const std::filesystem::path& path, const std::vector<std::uint32_t>& pixels, int width, int height, Scratch& scratch) noexcept;
+    //Returns false, leaving pixels empty, if the file is missing or was not written by Write.
+    bool Read(const std::filesystem::path& path, std::vector<std::uint32_t>& pixels, int& width, int& height) noexcept;
+}
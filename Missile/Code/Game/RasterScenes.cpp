@@ -0,0 +1,245 @@
+#include "Game/RasterScenes.hpp"
+
+#include "Game/GameCommon.hpp"
+#include "Game/PngFile.hpp"
+#include "Game/SoftwareRasterizer.hpp"
+#include "Game/WorkerPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <random>
+#include <system_error>
+
+namespace {
+    constexpr const std::array<Vector2, static_cast<std::size_t>(SpriteId::Max)> shipped_sprite_dimensions{
+        Vector2{ 66.0f, 44.0f }
+        , Vector2{ 66.0f, 44.0f }
+        , Vector2{ 8.0f, 8.0f }
+        , Vector2{ 44.0f, 31.0f }
+        , Vector2{ 8.0f, 8.0f }
+    };
+    //References are drawn small to keep them small on disk; the view still covers a 1600x900 playfield.
+    constexpr const int golden_width{256};
+    constexpr const int golden_height{144};
+    constexpr const float playfield_half_width{800.0f};
+    constexpr const float playfield_half_height{450.0f};
+    constexpr const float ground_height{40.0f};
+    constexpr const float skyline_y{playfield_half_height - ground_height - 22.0f};
+
+    //std::minstd_rand is fully specified, unlike the standard distributions, so scenes are identical on every platform.
+    float NextUnit(std::minstd_rand& random) noexcept {
+        return static_cast<float>(random() - std::minstd_rand::min()) / static_cast<float>(std::minstd_rand::max() - std::minstd_rand::min());
+    }
+
+    float NextRange(std::minstd_rand& random, float low, float high) noexcept {
+        return low + (high - low) * NextUnit(random);
+    }
+
+    RasterScenes::Scene MakeScene(std::string name, int width, int height, const Rgba& background, const Rgba& ground) noexcept {
+        auto scene = RasterScenes::Scene{};
+        scene.name = std::move(name);
+        scene.width = width;
+        scene.height = height;
+        scene.view = AABB2{ Vector2{ -playfield_half_width, -playfield_half_height }, Vector2{ playfield_half_width, playfield_half_height } };
+        scene.ground = AABB2{ Vector2{ -playfield_half_width, playfield_half_height - ground_height }, Vector2{ playfield_half_width, playfield_half_height } };
+        scene.snapshot.backgroundColor = background;
+        scene.snapshot.groundColor = ground;
+        return scene;
+    }
+
+    void AddLayout(RenderSnapshot& snapshot, const std::array<int, 3>& missilesRemaining, std::size_t cityCount, const Rgba& baseColor, const Rgba& cityColor) noexcept {
+        constexpr const std::array<float, 3> base_x{ -700.0f, 0.0f, 700.0f };
+        for (std::size_t i = 0u; i < base_x.size(); ++i) {
+            snapshot.bases.push_back(RenderSnapshot::Base{ Vector2{ base_x[i], skyline_y }, baseColor, snapshot.playerColor, missilesRemaining[i] });
+        }
+        constexpr const std::array<float, GameConstants::max_cities> city_x{ -480.0f, -340.0f, -200.0f, 200.0f, 340.0f, 480.0f };
+        for (std::size_t i = 0u; i < (std::min)(cityCount, city_x.size()); ++i) {
+            snapshot.cities.push_back(RenderSnapshot::Sprite{ Vector2{ city_x[i], skyline_y }, cityColor });
+        }
+    }
+
+    void AddTrails(RenderSnapshot& snapshot, std::minstd_rand& random, std::size_t count, const Rgba& trailColor, const Rgba& headColor) noexcept {
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto start_x = NextRange(random, -playfield_half_width, playfield_half_width);
+            const auto target_x = NextRange(random, -playfield_half_width, playfield_half_width);
+            const auto progress = NextUnit(random);
+            const auto start = Vector2{ start_x, -playfield_half_height };
+            const auto head = start + (Vector2{ target_x, skyline_y } - start) * progress;
+            snapshot.AddLine(RenderSubsystem::Missiles, RenderSnapshot::Line{ start, head, trailColor });
+            snapshot.AddPoint(RenderSubsystem::Missiles, RenderSnapshot::Point{ head, headColor });
+        }
+    }
+
+    void AddExplosions(RenderSnapshot& snapshot, std::minstd_rand& random, std::size_t count, const Rgba& color) noexcept {
+        for (std::size_t i = 0u; i < count; ++i) {
+            const auto x = NextRange(random, -playfield_half_width, playfield_half_width);
+            const auto y = NextRange(random, -playfield_half_height, skyline_y);
+            const auto radius = NextRange(random, 4.0f, GameConstants::max_explosion_size);
+            snapshot.explosions.push_back(RenderSnapshot::Disc{ Vector2{ x, y }, radius, color });
+        }
+    }
+
+    void DrawScene(const RasterScenes::Scene& scene, const RenderHandles& handles, SoftwareRasterizer& raster, WorkerPool* pool) noexcept {
+        if (raster.GetWidth() != scene.width || raster.GetHeight() != scene.height) {
+            raster.Resize(scene.width, scene.height);
+        }
+        RasterScenes::Rasterize(scene, handles, raster, pool);
+    }
+
+    std::size_t CountMismatches(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b) noexcept {
+        auto count = std::size_t{0u};
+        for (std::size_t i = 0u; i < a.size(); ++i) {
+            count += a[i] != b[i] ? 1u : 0u;
+        }
+        return count;
+    }
+}
+
+RenderHandles RasterScenes::MakeHandles() noexcept {
+    auto handles = RenderHandles{};
+    for (std::size_t i = 0u; i < shipped_sprite_dimensions.size(); ++i) {
+        handles.SetSpriteDimensions(static_cast<SpriteId>(i), shipped_sprite_dimensions[i]);
+    }
+    return handles;
+}
+
+std::vector<RasterScenes::Scene> RasterScenes::BuildGoldenScenes() noexcept {
+    auto scenes = std::vector<Scene>{};
+    auto random = std::minstd_rand{ 1983u };
+
+    //Early in a wave: full bases and cities, a few trails, one of each flier and opaque player explosions.
+    auto playfield = MakeScene("playfield", golden_width, golden_height, Rgba{ 0, 0, 0, 255 }, Rgba{ 255, 255, 0, 255 });
+    playfield.snapshot.playerColor = Rgba{ 0, 0, 255, 255 };
+    AddLayout(playfield.snapshot, { 10, 10, 10 }, GameConstants::max_cities, Rgba{ 255, 255, 0, 255 }, Rgba{ 0, 255, 255, 255 });
+    AddTrails(playfield.snapshot, random, 8u, Rgba{ 255, 0, 0, 255 }, Rgba{ 255, 255, 255, 255 });
+    playfield.snapshot.bombers.push_back(RenderSnapshot::Sprite{ Vector2{ -300.0f, -120.0f }, Rgba{ 255, 0, 0, 255 } });
+    playfield.snapshot.satellites.push_back(RenderSnapshot::Disc{ Vector2{ 420.0f, -180.0f }, GameConstants::satellite_radius, Rgba{ 255, 0, 0, 255 } });
+    AddExplosions(playfield.snapshot, random, 3u, Rgba{ 255, 255, 255, 255 });
+    scenes.push_back(std::move(playfield));
+
+    //Late in a wave on another palette: partial and empty bases, lost cities and overlapping translucent explosions.
+    auto low_missiles = MakeScene("low_missiles", golden_width, golden_height, Rgba{ 0, 0, 96, 255 }, Rgba{ 255, 0, 255, 255 });
+    low_missiles.snapshot.playerColor = Rgba{ 0, 255, 0, 255 };
+    AddLayout(low_missiles.snapshot, { 3, 0, 7 }, 4u, Rgba{ 255, 0, 255, 255 }, Rgba{ 255, 128, 0, 255 });
+    AddTrails(low_missiles.snapshot, random, 24u, Rgba{ 0, 255, 255, 255 }, Rgba{ 255, 255, 255, 255 });
+    AddExplosions(low_missiles.snapshot, random, 12u, Rgba{ 255, 255, 255, 160 });
+    scenes.push_back(std::move(low_missiles));
+
+    //Stress mode at reference size: blending over blending, discs and lines crossing tiles and the framebuffer edges.
+    auto chain_reaction = BuildStressScene(golden_width, golden_height, 64u, 96u);
+    chain_reaction.name = "chain_reaction";
+    scenes.push_back(std::move(chain_reaction));
+    return scenes;
+}
+
+RasterScenes::Scene RasterScenes::BuildStressScene(int width, int height, std::size_t explosionCount, std::size_t trailCount) noexcept {
+    auto random = std::minstd_rand{ 2600u };
+    auto scene = MakeScene("stress", width, height, Rgba{ 0, 0, 0, 255 }, Rgba{ 255, 255, 0, 255 });
+    scene.snapshot.playerColor = Rgba{ 0, 0, 255, 255 };
+    AddLayout(scene.snapshot, { 10, 4, 0 }, GameConstants::max_cities, Rgba{ 255, 255, 0, 255 }, Rgba{ 0, 255, 255, 255 });
+    AddTrails(scene.snapshot, random, trailCount, Rgba{ 255, 0, 0, 255 }, Rgba{ 255, 255, 255, 255 });
+    for (std::size_t i = 0u; i < GameConstants::stress_max_fliers_per_kind; ++i) {
+        const auto x = NextRange(random, -playfield_half_width, playfield_half_width);
+        const auto y = NextRange(random, -playfield_half_height, 0.0f);
+        if (i % 2u == 0u) {
+            scene.snapshot.bombers.push_back(RenderSnapshot::Sprite{ Vector2{ x, y }, Rgba{ 255, 0, 0, 255 } });
+        } else {
+            scene.snapshot.satellites.push_back(RenderSnapshot::Disc{ Vector2{ x, y }, GameConstants::satellite_radius, Rgba{ 255, 0, 0, 255 } });
+        }
+    }
+    AddExplosions(scene.snapshot, random, explosionCount, Rgba{ 255, 255, 255, 192 });
+    return scene;
+}
+
+void RasterScenes::Rasterize(const Scene& scene, const RenderHandles& handles, SoftwareRasterizer& raster, WorkerPool* pool) noexcept {
+    raster.Begin(scene.view, scene.snapshot.backgroundColor);
+    scene.snapshot.Rasterize(raster, handles, scene.ground);
+    raster.End(pool);
+}
+
+std::size_t RasterScenes::CheckGolden(const std::filesystem::path& folder, WorkerPool* pool, std::ostream& out) noexcept {
+    const auto handles = MakeHandles();
+    auto serial = SoftwareRasterizer{};
+    auto parallel = SoftwareRasterizer{};
+    auto reference = std::vector<std::uint32_t>{};
+    auto scratch = PngFile::Scratch{};
+    auto failed = std::size_t{0u};
+    for (const auto& scene : BuildGoldenScenes()) {
+        DrawScene(scene, handles, serial, nullptr);
+        DrawScene(scene, handles, parallel, pool);
+        const auto path = folder / std::filesystem::path{ scene.name + ".png" };
+        auto width = 0;
+        auto height = 0;
+        auto problem = std::string{};
+        if (const auto tile_mismatches = CountMismatches(serial.GetPixels(), parallel.GetPixels()); tile_mismatches != 0u) {
+            problem = std::format("{} pixels differ between one thread and the pool", tile_mismatches);
+        } else if (!PngFile::Read(path, reference, width, height)) {
+            problem = std::format("cannot read {}", path.string());
+        } else if (width != scene.width || height != scene.height) {
+            problem = std::format("reference is {}x{}, scene is {}x{}", width, height, scene.width, scene.height);
+        } else {
+            const auto mismatches = CountMismatches(serial.GetPixels(), reference);
+            const auto allowed = static_cast<std::size_t>(GameConstants::raster_golden_max_mismatch_fraction * static_cast<float>(reference.size()));
+            if (mismatches > allowed) {
+                problem = std::format("{} pixels differ from the reference, {} allowed", mismatches, allowed);
+            }
+        }
+        if (problem.empty()) {
+            out << std::format("PASS {}\n", scene.name);
+            continue;
+        }
+        ++failed;
+        out << std::format("FAIL {}: {}\n", scene.name, problem);
+        PngFile::Write(folder / std::filesystem::path{ scene.name + ".actual.png" }, serial.GetPixels(), serial.GetWidth(), serial.GetHeight(), scratch);
+    }
+    return failed;
+}
+
+bool RasterScenes::UpdateGolden(const std::filesystem::path& folder, WorkerPool* pool, std::ostream& out) noexcept {
+    auto ec = std::error_code{};
+    std::filesystem::create_directories(folder, ec);
+    const auto handles = MakeHandles();
+    auto raster = SoftwareRasterizer{};
+    auto scratch = PngFile::Scratch{};
+    auto succeeded = true;
+    for (const auto& scene : BuildGoldenScenes()) {
+        DrawScene(scene, handles, raster, pool);
+        const auto path = folder / std::filesystem::path{ scene.name + ".png" };
+        const auto written = PngFile::Write(path, raster.GetPixels(), raster.GetWidth(), raster.GetHeight(), scratch);
+        out << std::format("{} {}\n", written ? "WROTE" : "FAILED", path.string());
+        succeeded = succeeded && written;
+    }
+    return succeeded;
+}
+
+RasterScenes::BenchmarkResult RasterScenes::Benchmark(const Scene& scene, WorkerPool* pool, std::size_t frameCount) noexcept {
+    const auto handles = MakeHandles();
+    auto raster = SoftwareRasterizer{};
+    //One untimed frame sizes the framebuffer and tile bins.
+    DrawScene(scene, handles, raster, pool);
+    auto frame_times = std::vector<float>{};
+    frame_times.reserve(frameCount);
+    auto total = TimeUtils::FPMilliseconds::zero();
+    for (std::size_t i = 0u; i < frameCount; ++i) {
+        const auto start = TimeUtils::Now();
+        DrawScene(scene, handles, raster, pool);
+        const auto elapsed = TimeUtils::FPMilliseconds{ TimeUtils::Now() - start };
+        total += elapsed;
+        frame_times.push_back(elapsed.count());
+    }
+    auto result = BenchmarkResult{};
+    result.frames = frame_times.size();
+    result.primitives = raster.GetPrimitiveCount();
+    if (frame_times.empty()) {
+        return result;
+    }
+    std::sort(frame_times.begin(), frame_times.end());
+    result.average = total / static_cast<float>(frame_times.size());
+    result.p99 = TimeUtils::FPMilliseconds{ frame_times[(std::min)(frame_times.size() - 1u, frame_times.size() * 99u / 100u)] };
+    result.max = TimeUtils::FPMilliseconds{ frame_times.back() };
+    if (result.average.count() > 0.0f) {
+        result.framesPerSecond = 1000.0f / result.average.count();
+    }
+    return result;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+
+#include "Game/RenderHandles.hpp"
+#include "Game/RenderSnapshot.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class SoftwareRasterizer;
+class WorkerPool;
+
+//Playfield frames built from fixed data instead of a running game, so the software rasterizer can be checked against
+//reference images and timed without the engine's window, renderer or audio.
+//Sprites are drawn at the shipped texture sizes; text needs the engine's fonts and is left out.
+namespace RasterScenes {
+    struct Scene {
+        std::string name{};
+        int width{0};
+        int height{0};
+        AABB2 view{};
+        AABB2 ground{};
+        RenderSnapshot snapshot{};
+    };
+    struct BenchmarkResult {
+        std::size_t frames{0u};
+        std::size_t primitives{0u};
+        TimeUtils::FPMilliseconds average{};
+        TimeUtils::FPMilliseconds p99{};
+        TimeUtils::FPMilliseconds max{};
+        float framesPerSecond{0.0f};
+    };
+
+    RenderHandles MakeHandles() noexcept;
+    std::vector<Scene> BuildGoldenScenes() noexcept;
+    //A stress-mode chain reaction: explosionCount translucent discs over trailCount missile trails.
+    Scene BuildStressScene(int width, int height, std::size_t explosionCount, std::size_t trailCount) noexcept;
+    void Rasterize(const Scene& scene, const RenderHandles& handles, SoftwareRasterizer& raster, WorkerPool* pool) noexcept;
+
+    //Rasterizes every golden scene on the calling thread and on pool, and compares both with folder/<name>.png.
+    //The two must match exactly; the reference may differ in a few edge pixels. Prints one line per scene.
+    //A failing scene writes what it drew to folder/<name>.actual.png. Returns the number of scenes that failed.
+    std::size_t CheckGolden(const std::filesystem::path& folder, WorkerPool* pool, std::ostream& out) noexcept;
+    //Overwrites the references with what the rasterizer draws now. Review the images before committing them.
+    bool UpdateGolden(const std::filesystem::path& folder, WorkerPool* pool, std::ostream& out) noexcept;
+    //Times frameCount full rasterizations of scene, clear and binning included.
+    BenchmarkResult Benchmark(const Scene& scene, WorkerPool* pool, std::size_t frameCount) noexcept;
+}
@@ -0,0 +1,43 @@
+#include "Game/RenderHandles.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/Material.hpp"
+
+namespace {
+    constexpr const std::array<const char*, static_cast<std::size_t>(SpriteId::Max)> sprite_material_names{
+        "base"
+        , "city"
+        , "missile"
+        , "bomber"
+        , "crosshair"
+    };
+}
+
+void RenderHandles::Resolve() noexcept {
+    for (std::size_t i = 0u; i < m_sprites.size(); ++i) {
+        auto& sprite = m_sprites[i];
+        sprite.material = g_theRenderer->GetMaterial(sprite_material_names[i]);
+        const auto&& [x, y, _] = sprite.material->GetTexture(Material::TextureID::Diffuse)->GetDimensions().GetXYZ();
+        sprite.dimensions = Vector2{IntVector2{ x, y }};
+    }
+    m_flatMaterial = g_theRenderer->GetMaterial("__2D");
+    m_font = g_theRenderer->GetFont("System32");
+}
+
+void RenderHandles::SetSpriteDimensions(SpriteId id, Vector2 dimensions) noexcept {
+    m_sprites[static_cast<std::size_t>(id)].dimensions = dimensions;
+}
+
+const SpriteHandle& RenderHandles::GetSprite(SpriteId id) const noexcept {
+    return m_sprites[static_cast<std::size_t>(id)];
+}
+
+Material* RenderHandles::GetFlatMaterial() const noexcept {
+    return m_flatMaterial;
+}
+
+KerningFont* RenderHandles::GetFont() const noexcept {
+    return m_font;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+
+#include <array>
+#include <cstddef>
+
+class KerningFont;
+class Material;
+
+enum class SpriteId {
+    Base
+    , City
+    , Missile
+    , Bomber
+    , Crosshair
+    , Max
+};
+
+struct SpriteHandle {
+    Material* material{nullptr};
+    Vector2 dimensions{};
+};
+
+//Materials, diffuse texture sizes and the HUD font looked up once by name so draw code never touches the renderer's string maps.
+//The renderer owns everything here; handles stay valid until it unloads its resources.
+class RenderHandles {
+public:
+    RenderHandles() = default;
+    RenderHandles(const RenderHandles& other) = default;
+    RenderHandles(RenderHandles&& other) = default;
+    RenderHandles& operator=(const RenderHandles& other) = default;
+    RenderHandles& operator=(RenderHandles&& other) = default;
+    ~RenderHandles() = default;
+
+    void Resolve() noexcept;
+    //For drawing without the renderer, where there are no materials to read sizes from.
+    void SetSpriteDimensions(SpriteId id, Vector2 dimensions) noexcept;
+
+    const SpriteHandle& GetSprite(SpriteId id) const noexcept;
+    Material* GetFlatMaterial() const noexcept;
+    KerningFont* GetFont() const noexcept;
+
+protected:
+private:
+    std::array<SpriteHandle, static_cast<std::size_t>(SpriteId::Max)> m_sprites{};
+    Material* m_flatMaterial{nullptr};
+    KerningFont* m_font{nullptr};
+};
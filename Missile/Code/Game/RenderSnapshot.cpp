@@ -0,0 +1,241 @@
+#include "Game/RenderSnapshot.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+
+#include "Game/CircleLod.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/RenderHandles.hpp"
+#include "Game/SoftwareRasterizer.hpp"
+#include "Game/SpriteBatcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace {
+    struct IconOffset {
+        float x{};
+        float y{};
+    };
+
+    //Icon positions relative to the base, in missile-icon units. A base with n missiles shows the last n entries.
+    constexpr const std::array<IconOffset, GameConstants::max_base_missile_count> missile_icon_layout{
+        IconOffset{ 2.0f, 2.0f }
+        , IconOffset{ 1.0f, 2.0f }
+        , IconOffset{ -1.0f, 2.0f }
+        , IconOffset{ -2.0f, 2.0f }
+        , IconOffset{ 1.0f, 1.0f }
+        , IconOffset{ 0.0f, 1.0f }
+        , IconOffset{ -1.0f, 1.0f }
+        , IconOffset{ 0.5f, 0.0f }
+        , IconOffset{ -0.5f, 0.0f }
+        , IconOffset{ 0.0f, -1.0f }
+    };
+
+    void BatchRemainingMissiles(SpriteBatcher& batcher, const SpriteHandle& missile, const RenderSnapshot::Base& base) noexcept {
+        const auto dims = missile.dimensions;
+        const auto count = static_cast<std::size_t>(std::clamp(base.missilesRemaining, 0, GameConstants::max_base_missile_count));
+        for (std::size_t i = missile_icon_layout.size() - count; i < missile_icon_layout.size(); ++i) {
+            const auto& offset = missile_icon_layout[i];
+            batcher.Add(missile.material, base.position + Vector2{ offset.x * dims.x, offset.y * dims.y }, dims, base.missileColor);
+        }
+    }
+
+    void RenderBaseWarning(const KerningFont* font, const RenderSnapshot::Base& base, const std::string& text, RenderStats& stats) noexcept {
+        const auto S = Matrix4::I;
+        const auto R = Matrix4::I;
+        const auto T = Matrix4::CreateTranslationMatrix(base.position + Vector2{-0.5f * font->CalculateTextWidth(text), 24.0f});
+        const auto M = Matrix4::MakeSRT(S, R, T);
+        g_theRenderer->DrawTextLine(M, font, text, base.missileColor);
+        //One quad per glyph. The font's material is owned by the renderer, so it always counts as a switch.
+        stats.AddDraw(RenderSubsystem::Bases, nullptr, text.size() * 4u, text.size() * 6u);
+    }
+
+    //Returns the number of segments appended. Each disc adds one vertex more than its segments, and three indices per segment.
+    std::size_t AppendDiscs(Mesh::Builder& geometry, const RenderHandles& handles, const std::vector<RenderSnapshot::Disc>& discs, float pixelsPerUnit) noexcept {
+        if (discs.empty()) {
+            return 0u;
+        }
+        auto segments = std::size_t{0u};
+        geometry.Begin(PrimitiveType::Triangles);
+        for (const auto& disc : discs) {
+            segments += CircleLod::AppendFilledCircle(geometry, disc.center, disc.radius, pixelsPerUnit, disc.color);
+        }
+        geometry.End(handles.GetFlatMaterial());
+        return segments;
+    }
+
+    void BatchSprites(SpriteBatcher& batcher, const SpriteHandle& handle, const std::vector<RenderSnapshot::Sprite>& sprites) noexcept {
+        for (const auto& sprite : sprites) {
+            batcher.Add(handle.material, sprite.position, handle.dimensions, sprite.color);
+        }
+    }
+}
+
+void RenderSnapshot::Clear() noexcept {
+    lines.clear();
+    points.clear();
+    bombers.clear();
+    satellites.clear();
+    cities.clear();
+    explosions.clear();
+    bases.clear();
+    lineCounts = {};
+    pointCounts = {};
+    showRadarLine = false;
+}
+
+void RenderSnapshot::AddLine(RenderSubsystem source, const Line& line) noexcept {
+    lines.push_back(line);
+    ++lineCounts[static_cast<std::size_t>(source)];
+}
+
+void RenderSnapshot::AddPoint(RenderSubsystem source, const Point& point) noexcept {
+    points.push_back(point);
+    ++pointCounts[static_cast<std::size_t>(source)];
+}
+
+void RenderSnapshot::Render(SpriteBatcher& batcher, Mesh::Builder& geometry, const RenderHandles& handles, float pixelsPerUnit, RenderStats& stats) const noexcept {
+    auto* flat = handles.GetFlatMaterial();
+    geometry.Clear();
+    if (!lines.empty()) {
+        geometry.Begin(PrimitiveType::Lines);
+        for (const auto& line : lines) {
+            geometry.SetColor(line.color);
+            geometry.AddVertex(line.start);
+            geometry.AddVertex(line.end);
+            geometry.AddIndicies(Mesh::Builder::Primitive::Line);
+        }
+        geometry.End(flat);
+        stats.AddSharedRange(flat, lineCounts, 2u, 2u);
+    }
+    if (!points.empty()) {
+        geometry.Begin(PrimitiveType::Points);
+        for (const auto& point : points) {
+            geometry.SetColor(point.color);
+            geometry.AddVertex(point.position);
+            geometry.AddIndicies(Mesh::Builder::Primitive::Point);
+        }
+        geometry.End(flat);
+        stats.AddSharedRange(flat, pointCounts, 1u, 1u);
+    }
+    if (const auto satellite_segments = AppendDiscs(geometry, handles, satellites, pixelsPerUnit); satellite_segments != 0u) {
+        stats.AddRange(RenderSubsystem::Fliers, flat, satellite_segments + satellites.size(), satellite_segments * 3u);
+    }
+    g_theRenderer->SetModelMatrix();
+    Mesh::Render(geometry);
+
+    batcher.Begin();
+    const auto& bomber_sprite = handles.GetSprite(SpriteId::Bomber);
+    BatchSprites(batcher, bomber_sprite, bombers);
+    const auto bomber_quads = batcher.GetQuadCount();
+    const auto& missile_sprite = handles.GetSprite(SpriteId::Missile);
+    for (const auto& base : bases) {
+        if (base.missilesRemaining != 0) {
+            BatchRemainingMissiles(batcher, missile_sprite, base);
+        }
+    }
+    const auto icon_quads = batcher.GetQuadCount() - bomber_quads;
+    batcher.Flush();
+    //Flush draws one range per material in the order the materials were first added.
+    if (bomber_quads != 0u) {
+        stats.AddRange(RenderSubsystem::Fliers, bomber_sprite.material, bomber_quads * 4u, bomber_quads * 6u);
+    }
+    if (icon_quads != 0u) {
+        stats.AddRange(RenderSubsystem::Bases, missile_sprite.material, icon_quads * 4u, icon_quads * 6u);
+    }
+
+    const auto* font = handles.GetFont();
+    for (const auto& base : bases) {
+        if (base.missilesRemaining == 0) {
+            RenderBaseWarning(font, base, "OUT", stats);
+        } else if (base.missilesRemaining < GameConstants::low_missile_count) {
+            RenderBaseWarning(font, base, "LOW", stats);
+        }
+    }
+
+    if (!explosions.empty()) {
+        geometry.Clear();
+        const auto explosion_segments = AppendDiscs(geometry, handles, explosions, pixelsPerUnit);
+        stats.AddRange(RenderSubsystem::Explosions, flat, explosion_segments + explosions.size(), explosion_segments * 3u);
+        g_theRenderer->SetModelMatrix();
+        Mesh::Render(geometry);
+    }
+}
+
+void RenderSnapshot::Rasterize(SoftwareRasterizer& raster, const RenderHandles& handles, const AABB2& ground) const noexcept {
+    raster.DrawRect(ground.CalcCenter(), ground.CalcDimensions(), groundColor);
+    const auto& base_sprite = handles.GetSprite(SpriteId::Base);
+    for (const auto& base : bases) {
+        raster.DrawRect(base.position, base_sprite.dimensions, base.baseColor);
+    }
+    const auto& city_sprite = handles.GetSprite(SpriteId::City);
+    for (const auto& city : cities) {
+        raster.DrawRect(city.position, city_sprite.dimensions, city.color);
+    }
+
+    for (const auto& line : lines) {
+        raster.DrawLine(line.start, line.end, line.color);
+    }
+    for (const auto& point : points) {
+        raster.DrawPoint(point.position, point.color);
+    }
+    const auto& bomber_sprite = handles.GetSprite(SpriteId::Bomber);
+    for (const auto& bomber : bombers) {
+        raster.DrawRect(bomber.position, bomber_sprite.dimensions, bomber.color);
+    }
+    for (const auto& satellite : satellites) {
+        raster.DrawFilledCircle(satellite.center, satellite.radius, satellite.color);
+    }
+
+    const auto& missile_sprite = handles.GetSprite(SpriteId::Missile);
+    const auto* font = handles.GetFont();
+    for (const auto& base : bases) {
+        const auto count = static_cast<std::size_t>(std::clamp(base.missilesRemaining, 0, GameConstants::max_base_missile_count));
+        const auto dims = missile_sprite.dimensions;
+        for (std::size_t i = missile_icon_layout.size() - count; i < missile_icon_layout.size(); ++i) {
+            const auto& offset = missile_icon_layout[i];
+            raster.DrawRect(base.position + Vector2{ offset.x * dims.x, offset.y * dims.y }, dims, base.missileColor);
+        }
+        const auto* warning = base.missilesRemaining == 0 ? "OUT" : (base.missilesRemaining < GameConstants::low_missile_count ? "LOW" : nullptr);
+        if (warning != nullptr && font != nullptr) {
+            const auto text_dims = Vector2{ font->CalculateTextWidth(warning), font->CalculateTextHeight(warning) };
+            raster.DrawRect(base.position + Vector2{ 0.0f, 24.0f - 0.5f * text_dims.y }, text_dims, base.missileColor);
+        }
+    }
+
+    for (const auto& explosion : explosions) {
+        raster.DrawFilledCircle(explosion.center, explosion.radius, explosion.color);
+    }
+}
+
+RenderSnapshot& RenderSnapshotBuffer::BeginWrite() noexcept {
+    const auto back = 1u - m_front.load();
+    //Wait out a reader that grabbed this buffer just before the last Publish.
+    for (auto reading = m_readIndex.load(); reading == back; reading = m_readIndex.load()) {
+        m_readIndex.wait(reading);
+    }
+    m_snapshots[back].Clear();
+    return m_snapshots[back];
+}
+
+void RenderSnapshotBuffer::Publish() noexcept {
+    m_front.store(1u - m_front.load());
+}
+
+const RenderSnapshot& RenderSnapshotBuffer::AcquireFront() noexcept {
+    for (;;) {
+        const auto front = m_front.load();
+        m_readIndex.store(front);
+        if (m_front.load() == front) {
+            return m_snapshots[front];
+        }
+    }
+}
+
+void RenderSnapshotBuffer::ReleaseFront() noexcept {
+    m_readIndex.store(no_reader);
+    m_readIndex.notify_all();
+}
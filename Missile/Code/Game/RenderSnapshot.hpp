@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include "Engine/Renderer/Mesh.hpp"
+
+#include "Game/RenderStats.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class RenderHandles;
+class SoftwareRasterizer;
+class SpriteBatcher;
+
+//Everything needed to draw one frame of the playfield, copied out of the simulation at EndFrame.
+//Rendering reads only this, never the live entities.
+struct RenderSnapshot {
+    struct Sprite {
+        Vector2 position{};
+        Rgba color{};
+    };
+    struct Disc {
+        Vector2 center{};
+        float radius{};
+        Rgba color{};
+    };
+    struct Line {
+        Vector2 start{};
+        Vector2 end{};
+        Rgba color{};
+    };
+    struct Point {
+        Vector2 position{};
+        Rgba color{};
+    };
+    struct Base {
+        Vector2 position{};
+        Rgba baseColor{};
+        Rgba missileColor{};
+        int missilesRemaining{};
+    };
+
+    void Clear() noexcept;
+    void AddLine(RenderSubsystem source, const Line& line) noexcept;
+    void AddPoint(RenderSubsystem source, const Point& point) noexcept;
+    //Draws the captured dynamic objects. Ground, bases and cities come from the static layer;
+    //crosshair and radar line stay with the state since they depend on the camera.
+    //Textured sprites go through batcher, one draw per material.
+    //Lines, points and satellites are written into geometry as one range each; explosions reuse it after the text.
+    //Discs are tessellated for their size on screen, pixelsPerUnit being the current world-to-pixel scale.
+    void Render(SpriteBatcher& batcher, Mesh::Builder& geometry, const RenderHandles& handles, float pixelsPerUnit, RenderStats& stats) const noexcept;
+    //Draws the whole playfield, static layer included, in the same order as Render. Sprites become flat tinted rects
+    //and text becomes its bounding box, since textures and glyphs live on the GPU.
+    void Rasterize(SoftwareRasterizer& raster, const RenderHandles& handles, const AABB2& ground) const noexcept;
+
+    Rgba backgroundColor{Rgba::Black};
+    Rgba groundColor{};
+    Rgba playerColor{};
+    Vector2 crosshairPosition{};
+    bool showRadarLine{false};
+    //Bumped whenever ground, base or city colours change; the static layer rebuilds when it sees a new value.
+    std::uint32_t staticSceneGeneration{0u};
+    //Missile trails, target markers and satellite frames. Kept as plain data so any backend can draw them.
+    std::vector<Line> lines{};
+    std::vector<Point> points{};
+    //How many of lines and points each subsystem added, for render statistics.
+    std::array<std::uint32_t, RenderStats::subsystem_count> lineCounts{};
+    std::array<std::uint32_t, RenderStats::subsystem_count> pointCounts{};
+    std::vector<Sprite> bombers{};
+    std::vector<Disc> satellites{};
+    std::vector<Sprite> cities{};
+    std::vector<Disc> explosions{};
+    std::vector<Base> bases{};
+};
+
+//Simulation writes the back snapshot while rendering reads the front one.
+//BeginWrite waits for a reader still holding the back snapshot, so a reader never sees its snapshot being overwritten.
+class RenderSnapshotBuffer {
+public:
+    RenderSnapshotBuffer() = default;
+    RenderSnapshotBuffer(const RenderSnapshotBuffer& other) = delete;
+    RenderSnapshotBuffer(RenderSnapshotBuffer&& other) = delete;
+    RenderSnapshotBuffer& operator=(const RenderSnapshotBuffer& other) = delete;
+    RenderSnapshotBuffer& operator=(RenderSnapshotBuffer&& other) = delete;
+    ~RenderSnapshotBuffer() = default;
+
+    RenderSnapshot& BeginWrite() noexcept;
+    void Publish() noexcept;
+
+    const RenderSnapshot& AcquireFront() noexcept;
+    void ReleaseFront() noexcept;
+
+protected:
+private:
+    static constexpr const std::size_t no_reader{2u};
+
+    std::array<RenderSnapshot, 2> m_snapshots{};
+    std::atomic<std::size_t> m_front{0u};
+    std::atomic<std::size_t> m_readIndex{no_reader};
+};
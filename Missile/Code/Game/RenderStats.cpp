@@ -0,0 +1,134 @@
+#include "Game/RenderStats.hpp"
+
+#include "Game/GameCommon.hpp"
+
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+std::string_view ToString(RenderSubsystem subsystem) noexcept {
+    switch (subsystem) {
+    case RenderSubsystem::Ground: return "Ground";
+    case RenderSubsystem::Cities: return "Cities";
+    case RenderSubsystem::Bases: return "Bases";
+    case RenderSubsystem::Missiles: return "Missiles";
+    case RenderSubsystem::Fliers: return "Fliers";
+    case RenderSubsystem::Explosions: return "Explosions";
+    case RenderSubsystem::Hud: return "Hud";
+    default: return "Unknown";
+    }
+}
+
+RenderCounters& RenderCounters::operator+=(const RenderCounters& rhs) noexcept {
+    drawCalls += rhs.drawCalls;
+    vertices += rhs.vertices;
+    indices += rhs.indices;
+    materialSwitches += rhs.materialSwitches;
+    batches += rhs.batches;
+    return *this;
+}
+
+void RenderStats::BeginFrame() noexcept {
+    m_current = FrameCounters{};
+    m_lastMaterial = nullptr;
+}
+
+void RenderStats::EndFrame() noexcept {
+    m_last = m_current;
+    if (m_history.size() < GameConstants::render_stats_history_frames) {
+        m_history.push_back(m_current);
+    } else {
+        m_history[m_historyNext] = m_current;
+    }
+    m_historyNext = (m_historyNext + 1u) % GameConstants::render_stats_history_frames;
+    ++m_frameIndex;
+}
+
+void RenderStats::Reset() noexcept {
+    m_current = FrameCounters{};
+    m_last = FrameCounters{};
+    m_history.clear();
+    m_historyNext = 0u;
+    m_frameIndex = 0u;
+    m_lastMaterial = nullptr;
+}
+
+void RenderStats::AddRange(RenderSubsystem subsystem, const Material* material, std::size_t vertices, std::size_t indices) noexcept {
+    auto& counters = Charge(subsystem, material);
+    ++counters.batches;
+    counters.vertices += static_cast<std::uint32_t>(vertices);
+    counters.indices += static_cast<std::uint32_t>(indices);
+}
+
+void RenderStats::AddSharedRange(const Material* material, const std::array<std::uint32_t, subsystem_count>& primitiveCounts, std::size_t verticesPerPrimitive, std::size_t indicesPerPrimitive) noexcept {
+    auto charged = false;
+    for (std::size_t i = 0u; i < subsystem_count; ++i) {
+        if (primitiveCounts[i] == 0u) {
+            continue;
+        }
+        auto& counters = m_current[i];
+        if (!charged) {
+            Charge(static_cast<RenderSubsystem>(i), material);
+            ++counters.batches;
+            charged = true;
+        }
+        counters.vertices += primitiveCounts[i] * static_cast<std::uint32_t>(verticesPerPrimitive);
+        counters.indices += primitiveCounts[i] * static_cast<std::uint32_t>(indicesPerPrimitive);
+    }
+}
+
+void RenderStats::AddDraw(RenderSubsystem subsystem, const Material* material, std::size_t vertices, std::size_t indices) noexcept {
+    auto& counters = Charge(subsystem, material);
+    counters.vertices += static_cast<std::uint32_t>(vertices);
+    counters.indices += static_cast<std::uint32_t>(indices);
+}
+
+const RenderStats::FrameCounters& RenderStats::GetLastFrame() const noexcept {
+    return m_last;
+}
+
+RenderCounters RenderStats::GetLastFrameTotal() const noexcept {
+    auto total = RenderCounters{};
+    for (const auto& counters : m_last) {
+        total += counters;
+    }
+    return total;
+}
+
+std::size_t RenderStats::GetHistoryFrameCount() const noexcept {
+    return m_history.size();
+}
+
+bool RenderStats::ExportCsv(const std::filesystem::path& path) const noexcept {
+    std::ofstream file{ path, std::ios::trunc };
+    if (!file) {
+        return false;
+    }
+    file << "frame,subsystem,draw_calls,vertices,indices,material_switches,batches\n";
+    //Until the history wraps, the oldest frame is at the front.
+    const auto count = m_history.size();
+    const auto oldest = count < GameConstants::render_stats_history_frames ? std::size_t{0u} : m_historyNext;
+    const auto first_frame = m_frameIndex - count;
+    auto line = std::string{};
+    for (std::size_t i = 0u; i < count; ++i) {
+        const auto& frame = m_history[(oldest + i) % count];
+        for (std::size_t s = 0u; s < subsystem_count; ++s) {
+            const auto& c = frame[s];
+            line.clear();
+            std::format_to(std::back_inserter(line), "{},{},{},{},{},{},{}\n", first_frame + i, ToString(static_cast<RenderSubsystem>(s)), c.drawCalls, c.vertices, c.indices, c.materialSwitches, c.batches);
+            file << line;
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+RenderCounters& RenderStats::Charge(RenderSubsystem subsystem, const Material* material) noexcept {
+    auto& counters = m_current[static_cast<std::size_t>(subsystem)];
+    ++counters.drawCalls;
+    if (material != m_lastMaterial) {
+        ++counters.materialSwitches;
+        m_lastMaterial = material;
+    }
+    return counters;
+}
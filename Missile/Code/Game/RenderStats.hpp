@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+class Material;
+
+enum class RenderSubsystem : std::uint8_t {
+    Ground
+    , Cities
+    , Bases
+    , Missiles
+    , Fliers
+    , Explosions
+    , Hud
+    , Max
+};
+
+std::string_view ToString(RenderSubsystem subsystem) noexcept;
+
+struct RenderCounters {
+    std::uint32_t drawCalls{0u};
+    std::uint32_t vertices{0u};
+    std::uint32_t indices{0u};
+    std::uint32_t materialSwitches{0u};
+    std::uint32_t batches{0u};
+
+    RenderCounters& operator+=(const RenderCounters& rhs) noexcept;
+};
+
+//Per-frame draw submission counters, attributed to the subsystem that issued them.
+//The engine renderer exposes no counters of its own, so these are recorded where the game submits geometry.
+//A material switch is counted whenever a draw uses a different material than the draw before it.
+class RenderStats {
+public:
+    static constexpr const std::size_t subsystem_count{static_cast<std::size_t>(RenderSubsystem::Max)};
+    using FrameCounters = std::array<RenderCounters, subsystem_count>;
+
+    RenderStats() = default;
+    RenderStats(const RenderStats& other) = default;
+    RenderStats(RenderStats&& other) = default;
+    RenderStats& operator=(const RenderStats& other) = default;
+    RenderStats& operator=(RenderStats&& other) = default;
+    ~RenderStats() = default;
+
+    void BeginFrame() noexcept;
+    //Publishes the frame to GetLastFrame and the CSV history.
+    void EndFrame() noexcept;
+    void Reset() noexcept;
+
+    //One Mesh::Builder Begin/End range drawn by Mesh::Render.
+    void AddRange(RenderSubsystem subsystem, const Material* material, std::size_t vertices, std::size_t indices) noexcept;
+    //One range holding geometry from several subsystems. Vertices and indices are split by primitiveCounts;
+    //the draw, batch and any material switch are charged to the first subsystem that contributed.
+    void AddSharedRange(const Material* material, const std::array<std::uint32_t, subsystem_count>& primitiveCounts, std::size_t verticesPerPrimitive, std::size_t indicesPerPrimitive) noexcept;
+    //One immediate-mode renderer call outside any range.
+    void AddDraw(RenderSubsystem subsystem, const Material* material, std::size_t vertices, std::size_t indices) noexcept;
+
+    const FrameCounters& GetLastFrame() const noexcept;
+    RenderCounters GetLastFrameTotal() const noexcept;
+    std::size_t GetHistoryFrameCount() const noexcept;
+
+    //Writes one row per subsystem for every recorded frame, oldest first. Returns false if the file cannot be written.
+    bool ExportCsv(const std::filesystem::path& path) const noexcept;
+
+protected:
+private:
+    RenderCounters& Charge(RenderSubsystem subsystem, const Material* material) noexcept;
+
+    FrameCounters m_current{};
+    FrameCounters m_last{};
+    std::vector<FrameCounters> m_history{};
+    std::size_t m_historyNext{0u};
+    std::uint64_t m_frameIndex{0u};
+    const Material* m_lastMaterial{nullptr};
+};
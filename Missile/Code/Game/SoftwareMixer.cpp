@@ -0,0 +1,223 @@
+#include "Game/SoftwareMixer.hpp"
+
+#include "Game/SoundBank.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MISSILE_MIXER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+    //Adds gain * src[0..frames) to both channels of the interleaved stereo out.
+    void MixMonoUnit(const float* src, float* out, std::size_t frames, float gain) noexcept {
+        auto i = std::size_t{0u};
+#ifdef MISSILE_MIXER_SSE2
+        const auto g = _mm_set1_ps(gain);
+        for (; i + 4u <= frames; i += 4u) {
+            const auto s = _mm_mul_ps(_mm_loadu_ps(src + i), g);
+            auto* dst = out + i * 2u;
+            _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_unpacklo_ps(s, s)));
+            _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_unpackhi_ps(s, s)));
+        }
+#endif
+        for (; i < frames; ++i) {
+            const auto s = src[i] * gain;
+            out[i * 2u] += s;
+            out[i * 2u + 1u] += s;
+        }
+    }
+
+    void MixStereoUnit(const float* src, float* out, std::size_t frames, float gain) noexcept {
+        const auto samples = frames * 2u;
+        auto i = std::size_t{0u};
+#ifdef MISSILE_MIXER_SSE2
+        const auto g = _mm_set1_ps(gain);
+        for (; i + 4u <= samples; i += 4u) {
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(src + i), g)));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] += src[i] * gain;
+        }
+    }
+
+    constexpr const int fraction_bits{32};
+    constexpr const std::uint64_t fraction_mask{(std::uint64_t{1u} << fraction_bits) - 1u};
+    constexpr const float fraction_scale{1.0f / static_cast<float>(std::uint64_t{1u} << fraction_bits)};
+
+    float GetFraction(std::uint64_t position) noexcept {
+        return static_cast<float>(static_cast<std::uint32_t>(position & fraction_mask)) * fraction_scale;
+    }
+
+    //Linear interpolation of a mono clip from a 32.32 fixed-point position advancing step per output frame.
+    //The caller guarantees every frame read, including the one after each position, is inside the clip.
+    void MixMonoResampled(const float* src, float* out, std::size_t frames, std::uint64_t position, std::uint64_t step, float gain) noexcept {
+        auto i = std::size_t{0u};
+#ifdef MISSILE_MIXER_SSE2
+        const auto g = _mm_set1_ps(gain);
+        const auto half_scale = _mm_set1_ps(fraction_scale * 2.0f);
+        for (; i + 4u <= frames; i += 4u) {
+            const auto p0 = position;
+            const auto p1 = p0 + step;
+            const auto p2 = p1 + step;
+            const auto p3 = p2 + step;
+            position = p3 + step;
+            const auto* s0 = src + (p0 >> fraction_bits);
+            const auto* s1 = src + (p1 >> fraction_bits);
+            const auto* s2 = src + (p2 >> fraction_bits);
+            const auto* s3 = src + (p3 >> fraction_bits);
+            const auto a = _mm_set_ps(s3[0], s2[0], s1[0], s0[0]);
+            const auto b = _mm_set_ps(s3[1], s2[1], s1[1], s0[1]);
+            //The fraction is converted as a signed 31-bit integer since SSE2 has no unsigned conversion.
+            const auto bits = _mm_set_epi32(static_cast<int>((p3 & fraction_mask) >> 1), static_cast<int>((p2 & fraction_mask) >> 1), static_cast<int>((p1 & fraction_mask) >> 1), static_cast<int>((p0 & fraction_mask) >> 1));
+            const auto f = _mm_mul_ps(_mm_cvtepi32_ps(bits), half_scale);
+            const auto s = _mm_mul_ps(_mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), f)), g);
+            auto* dst = out + i * 2u;
+            _mm_storeu_ps(dst, _mm_add_ps(_mm_loadu_ps(dst), _mm_unpacklo_ps(s, s)));
+            _mm_storeu_ps(dst + 4, _mm_add_ps(_mm_loadu_ps(dst + 4), _mm_unpackhi_ps(s, s)));
+        }
+#endif
+        for (; i < frames; ++i, position += step) {
+            const auto* a = src + (position >> fraction_bits);
+            const auto s = (a[0] + (a[1] - a[0]) * GetFraction(position)) * gain;
+            out[i * 2u] += s;
+            out[i * 2u + 1u] += s;
+        }
+    }
+
+    //Clips with two or more channels; anything past the first two is ignored.
+    void MixMultiResampled(const float* src, std::size_t channels, float* out, std::size_t frames, std::uint64_t position, std::uint64_t step, float gain) noexcept {
+        for (std::size_t i = 0u; i < frames; ++i, position += step) {
+            const auto* a = src + (position >> fraction_bits) * channels;
+            const auto* b = a + channels;
+            const auto frac = GetFraction(position);
+            out[i * 2u] += (a[0] + (b[0] - a[0]) * frac) * gain;
+            out[i * 2u + 1u] += (a[1] + (b[1] - a[1]) * frac) * gain;
+        }
+    }
+}
+
+SoftwareMixer::SoftwareMixer(std::uint32_t outputRate) noexcept
+    : m_outputRate{outputRate}
+{
+    /* DO NOTHING */
+}
+
+SoftwareMixer::VoiceId SoftwareMixer::Start(const SoundClip& clip, float volume, float frequency, int loopCount) noexcept {
+    //Interpolation reads one frame ahead, so a clip needs at least two.
+    if (clip.frameCount < 2u || clip.channels == 0u || clip.sampleRate == 0u || frequency <= 0.0f) {
+        return invalid_voice;
+    }
+    auto voice = Voice{};
+    voice.samples = clip.samples.data();
+    voice.frameCount = clip.frameCount;
+    voice.channels = clip.channels;
+    const auto step = static_cast<double>(clip.sampleRate) * static_cast<double>(frequency) / static_cast<double>(m_outputRate);
+    voice.step = static_cast<std::uint64_t>(std::llround(std::ldexp(step, fraction_bits)));
+    if (voice.step == 0u) {
+        return invalid_voice;
+    }
+    voice.gain = volume;
+    voice.loopsRemaining = (std::max)(loopCount, 0);
+    voice.id = m_nextId.fetch_add(1u, std::memory_order_relaxed);
+    if (voice.id == invalid_voice) {
+        voice.id = m_nextId.fetch_add(1u, std::memory_order_relaxed);
+    }
+    std::scoped_lock lock(m_mutex);
+    m_changes.push_back(Change{ voice, false });
+    return voice.id;
+}
+
+void SoftwareMixer::Stop(VoiceId id) noexcept {
+    auto change = Change{};
+    change.voice.id = id;
+    change.stop = true;
+    std::scoped_lock lock(m_mutex);
+    m_changes.push_back(change);
+}
+
+void SoftwareMixer::MixBlock(std::span<float> out) noexcept {
+    const auto start = TimeUtils::Now();
+    ApplyChanges();
+    const auto voice_count = m_voices.size();
+    std::fill(out.begin(), out.end(), 0.0f);
+    const auto frames = (std::min)(out.size() / output_channels, block_frames);
+    std::erase_if(m_voices, [&](Voice& voice) { return !MixVoice(voice, out.data(), frames); });
+    m_activeVoices.store(m_voices.size(), std::memory_order_relaxed);
+
+    const auto elapsed = TimeUtils::FPMicroseconds{ TimeUtils::Now() - start };
+    std::scoped_lock lock(m_mutex);
+    ++m_stats.blocks;
+    m_stats.lastBlock = elapsed;
+    m_stats.maxBlock = (std::max)(m_stats.maxBlock, elapsed);
+    m_stats.totalTime += elapsed;
+    m_stats.peakVoices = (std::max)(m_stats.peakVoices, voice_count);
+}
+
+std::uint32_t SoftwareMixer::GetOutputRate() const noexcept {
+    return m_outputRate;
+}
+
+TimeUtils::FPSeconds SoftwareMixer::GetBlockDuration() const noexcept {
+    return TimeUtils::FPSeconds{ static_cast<float>(block_frames) / static_cast<float>(m_outputRate) };
+}
+
+std::size_t SoftwareMixer::GetActiveVoiceCount() const noexcept {
+    return m_activeVoices.load(std::memory_order_relaxed);
+}
+
+SoftwareMixer::Stats SoftwareMixer::GetStats() const noexcept {
+    std::scoped_lock lock(m_mutex);
+    return m_stats;
+}
+
+void SoftwareMixer::ApplyChanges() noexcept {
+    {
+        std::scoped_lock lock(m_mutex);
+        m_applying.swap(m_changes);
+    }
+    for (const auto& change : m_applying) {
+        if (change.stop) {
+            std::erase_if(m_voices, [id = change.voice.id](const Voice& voice) { return voice.id == id; });
+        } else {
+            m_voices.push_back(change.voice);
+        }
+    }
+    m_applying.clear();
+}
+
+bool SoftwareMixer::MixVoice(Voice& voice, float* out, std::size_t frames) const noexcept {
+    //Mono and stereo clips at the output rate are read frame by frame and play through the last frame.
+    //Everything else interpolates from the frame after each position, so it has to stop one frame short.
+    const auto is_direct = voice.step == std::uint64_t{1u} << fraction_bits && voice.channels <= 2u;
+    const auto end = (is_direct ? voice.frameCount : voice.frameCount - 1u) << fraction_bits;
+    auto done = std::size_t{0u};
+    while (done < frames) {
+        const auto available = voice.position < end ? static_cast<std::size_t>((end - voice.position + voice.step - 1u) / voice.step) : std::size_t{0u};
+        const auto count = (std::min)(frames - done, available);
+        auto* dst = out + done * output_channels;
+        if (voice.channels == 1u && is_direct) {
+            MixMonoUnit(voice.samples + (voice.position >> fraction_bits), dst, count, voice.gain);
+        } else if (voice.channels == 2u && is_direct) {
+            MixStereoUnit(voice.samples + (voice.position >> fraction_bits) * 2u, dst, count, voice.gain);
+        } else if (voice.channels == 1u) {
+            MixMonoResampled(voice.samples, dst, count, voice.position, voice.step, voice.gain);
+        } else {
+            MixMultiResampled(voice.samples, voice.channels, dst, count, voice.position, voice.step, voice.gain);
+        }
+        voice.position += static_cast<std::uint64_t>(count) * voice.step;
+        done += count;
+        if (voice.position < end) {
+            continue;
+        }
+        if (voice.loopsRemaining == 0) {
+            return false;
+        }
+        --voice.loopsRemaining;
+        voice.position -= end;
+    }
+    return true;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <vector>
+
+struct SoundClip;
+
+//Mixes clips from the sound bank into fixed-size blocks of interleaved stereo float.
+//Gain and linear resampling run four frames at a time with SSE2; mono and stereo clips at the output rate skip the interpolation.
+//Start and Stop may be called from any thread and take effect at the next block; MixBlock has a single caller.
+class SoftwareMixer {
+public:
+    using VoiceId = std::uint32_t;
+    static constexpr const VoiceId invalid_voice{0u};
+    static constexpr const std::size_t block_frames{256u};
+    static constexpr const std::size_t output_channels{2u};
+    static constexpr const std::size_t block_samples{block_frames * output_channels};
+
+    struct Stats {
+        std::uint64_t blocks{0u};
+        TimeUtils::FPMicroseconds lastBlock{};
+        TimeUtils::FPMicroseconds maxBlock{};
+        TimeUtils::FPMicroseconds totalTime{};
+        std::size_t peakVoices{0u};
+    };
+
+    SoftwareMixer() = default;
+    explicit SoftwareMixer(std::uint32_t outputRate) noexcept;
+    SoftwareMixer(const SoftwareMixer& other) = delete;
+    SoftwareMixer(SoftwareMixer&& other) = delete;
+    SoftwareMixer& operator=(const SoftwareMixer& other) = delete;
+    SoftwareMixer& operator=(SoftwareMixer&& other) = delete;
+    ~SoftwareMixer() = default;
+
+    //frequency scales the clip's playback rate. loopCount extra passes are played after the first.
+    //The clip must outlive the voice. Returns invalid_voice if the clip is empty.
+    VoiceId Start(const SoundClip& clip, float volume, float frequency, int loopCount) noexcept;
+    void Stop(VoiceId id) noexcept;
+
+    //Mixes the next block into out, which must hold block_samples floats, and retires finished voices.
+    void MixBlock(std::span<float> out) noexcept;
+
+    std::uint32_t GetOutputRate() const noexcept;
+    TimeUtils::FPSeconds GetBlockDuration() const noexcept;
+    std::size_t GetActiveVoiceCount() const noexcept;
+    Stats GetStats() const noexcept;
+
+protected:
+private:
+    struct Voice {
+        const float* samples{nullptr};
+        std::uint64_t frameCount{0u};
+        std::uint32_t channels{1u};
+        //Frames in 32.32 fixed point.
+        std::uint64_t position{0u};
+        std::uint64_t step{0u};
+        float gain{1.0f};
+        int loopsRemaining{0};
+        VoiceId id{invalid_voice};
+    };
+    struct Change {
+        Voice voice{};
+        bool stop{false};
+    };
+
+    void ApplyChanges() noexcept;
+    //Returns false once the voice has played its last frame.
+    bool MixVoice(Voice& voice, float* out, std::size_t frames) const noexcept;
+
+    std::vector<Voice> m_voices{};
+    std::vector<Change> m_changes{};
+    std::vector<Change> m_applying{};
+    //Guards the change list and the stats.
+    mutable std::mutex m_mutex{};
+    std::atomic<VoiceId> m_nextId{1u};
+    std::atomic<std::size_t> m_activeVoices{0u};
+    Stats m_stats{};
+    std::uint32_t m_outputRate{44100u};
+};
@@ -0,0 +1,293 @@
+#include "Game/SoftwareRasterizer.hpp"
+
+#include "Game/WorkerPool.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MISSILE_RASTER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+    std::uint32_t PackColor(const Rgba& color) noexcept {
+        return static_cast<std::uint32_t>(color.r)
+            | (static_cast<std::uint32_t>(color.g) << 8)
+            | (static_cast<std::uint32_t>(color.b) << 16)
+            | (static_cast<std::uint32_t>(color.a) << 24);
+    }
+
+    //Integer src-over blend of two packed channels per 32-bit lane, rounding x / 255 as (x + 128 + (x >> 8)) >> 8.
+    std::uint32_t BlendPixel(std::uint32_t dst, std::uint32_t srcRb, std::uint32_t srcG, std::uint32_t inverseAlpha) noexcept {
+        auto rb = srcRb + (dst & 0x00FF00FFu) * inverseAlpha;
+        auto g = srcG + ((dst >> 8) & 0x000000FFu) * inverseAlpha;
+        rb = ((rb + 0x00800080u + ((rb >> 8) & 0x00FF00FFu)) >> 8) & 0x00FF00FFu;
+        g = ((g + 0x00000080u + ((g >> 8) & 0x000000FFu)) >> 8) & 0x000000FFu;
+        return rb | (g << 8) | 0xFF000000u;
+    }
+
+#ifdef MISSILE_RASTER_SSE2
+    //The same blend as BlendPixel on two pixels widened to 16-bit channels. src holds each channel premultiplied by alpha.
+    //Every intermediate fits in 16 bits: 255 * 255 + 128 + 254 < 65536.
+    __m128i BlendChannels(__m128i dst, __m128i src, __m128i inverseAlpha, __m128i bias) noexcept {
+        const auto sum = _mm_add_epi16(src, _mm_mullo_epi16(dst, inverseAlpha));
+        return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(sum, bias), _mm_srli_epi16(sum, 8)), 8);
+    }
+#endif
+}
+
+void SoftwareRasterizer::Resize(int width, int height) noexcept {
+    m_width = (std::max)(0, width);
+    m_height = (std::max)(0, height);
+    m_tilesX = (m_width + tile_size - 1) / tile_size;
+    m_tilesY = (m_height + tile_size - 1) / tile_size;
+    m_pixels.assign(static_cast<std::size_t>(m_width) * static_cast<std::size_t>(m_height), 0u);
+    m_tileBins.resize(static_cast<std::size_t>(m_tilesX) * static_cast<std::size_t>(m_tilesY));
+}
+
+void SoftwareRasterizer::Begin(const AABB2& viewBounds, const Rgba& clearColor) noexcept {
+    m_viewBounds = viewBounds;
+    const auto view_dims = viewBounds.maxs - viewBounds.mins;
+    m_scale = Vector2{ static_cast<float>(m_width) / view_dims.x, static_cast<float>(m_height) / view_dims.y };
+    m_clearColor = PackColor(clearColor) | 0xFF000000u;
+    m_primitives.clear();
+    for (auto& bin : m_tileBins) {
+        bin.clear();
+    }
+}
+
+void SoftwareRasterizer::DrawRect(Vector2 center, Vector2 dimensions, const Rgba& color) noexcept {
+    const auto half = Vector2{ dimensions.x * m_scale.x, dimensions.y * m_scale.y } * 0.5f;
+    const auto c = ToPixels(center);
+    auto primitive = Primitive{ c - half, c + half, PackColor(color), PrimitiveKind::Rect };
+    //A pixel is covered when its center is inside the rect.
+    primitive.minX = static_cast<int>(std::ceil(primitive.a.x - 0.5f));
+    primitive.minY = static_cast<int>(std::ceil(primitive.a.y - 0.5f));
+    primitive.maxX = static_cast<int>(std::ceil(primitive.b.x - 0.5f));
+    primitive.maxY = static_cast<int>(std::ceil(primitive.b.y - 0.5f));
+    Submit(primitive);
+}
+
+void SoftwareRasterizer::DrawFilledCircle(Vector2 center, float radius, const Rgba& color) noexcept {
+    const auto c = ToPixels(center);
+    //Discs stay round on non-square view mappings by using the horizontal scale.
+    const auto r = radius * m_scale.x;
+    auto primitive = Primitive{ c, Vector2{ r, r }, PackColor(color), PrimitiveKind::Disc };
+    primitive.minX = static_cast<int>(std::floor(c.x - r));
+    primitive.minY = static_cast<int>(std::floor(c.y - r));
+    primitive.maxX = static_cast<int>(std::ceil(c.x + r)) + 1;
+    primitive.maxY = static_cast<int>(std::ceil(c.y + r)) + 1;
+    Submit(primitive);
+}
+
+void SoftwareRasterizer::DrawLine(Vector2 start, Vector2 end, const Rgba& color) noexcept {
+    const auto a = ToPixels(start);
+    const auto b = ToPixels(end);
+    auto primitive = Primitive{ a, b, PackColor(color), PrimitiveKind::Line };
+    primitive.minX = static_cast<int>(std::floor((std::min)(a.x, b.x)));
+    primitive.minY = static_cast<int>(std::floor((std::min)(a.y, b.y)));
+    primitive.maxX = static_cast<int>(std::floor((std::max)(a.x, b.x))) + 1;
+    primitive.maxY = static_cast<int>(std::floor((std::max)(a.y, b.y))) + 1;
+    Submit(primitive);
+}
+
+void SoftwareRasterizer::DrawPoint(Vector2 position, const Rgba& color) noexcept {
+    const auto p = ToPixels(position);
+    auto primitive = Primitive{ p, p, PackColor(color), PrimitiveKind::Rect };
+    primitive.minX = static_cast<int>(std::floor(p.x));
+    primitive.minY = static_cast<int>(std::floor(p.y));
+    primitive.maxX = primitive.minX + 1;
+    primitive.maxY = primitive.minY + 1;
+    Submit(primitive);
+}
+
+void SoftwareRasterizer::End(WorkerPool* pool) noexcept {
+    BinPrimitives();
+    const auto tile_count = m_tileBins.size();
+    if (pool == nullptr) {
+        for (std::size_t i = 0u; i < tile_count; ++i) {
+            RasterizeTile(i);
+        }
+        return;
+    }
+    pool->ParallelFor(tile_count, 4u, [this](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            RasterizeTile(i);
+        }
+    });
+}
+
+int SoftwareRasterizer::GetWidth() const noexcept {
+    return m_width;
+}
+
+int SoftwareRasterizer::GetHeight() const noexcept {
+    return m_height;
+}
+
+const std::vector<std::uint32_t>& SoftwareRasterizer::GetPixels() const noexcept {
+    return m_pixels;
+}
+
+std::size_t SoftwareRasterizer::GetPrimitiveCount() const noexcept {
+    return m_primitives.size();
+}
+
+Vector2 SoftwareRasterizer::ToPixels(Vector2 worldPosition) const noexcept {
+    return Vector2{ (worldPosition.x - m_viewBounds.mins.x) * m_scale.x, (worldPosition.y - m_viewBounds.mins.y) * m_scale.y };
+}
+
+void SoftwareRasterizer::Submit(Primitive primitive) noexcept {
+    primitive.minX = (std::max)(0, primitive.minX);
+    primitive.minY = (std::max)(0, primitive.minY);
+    primitive.maxX = (std::min)(m_width, primitive.maxX);
+    primitive.maxY = (std::min)(m_height, primitive.maxY);
+    if (primitive.maxX <= primitive.minX || primitive.maxY <= primitive.minY || (primitive.color >> 24) == 0u) {
+        return;
+    }
+    m_primitives.push_back(primitive);
+}
+
+void SoftwareRasterizer::BinPrimitives() noexcept {
+    for (std::size_t i = 0u; i < m_primitives.size(); ++i) {
+        const auto& primitive = m_primitives[i];
+        const auto first_tx = primitive.minX / tile_size;
+        const auto first_ty = primitive.minY / tile_size;
+        const auto last_tx = (primitive.maxX - 1) / tile_size;
+        const auto last_ty = (primitive.maxY - 1) / tile_size;
+        for (auto ty = first_ty; ty <= last_ty; ++ty) {
+            for (auto tx = first_tx; tx <= last_tx; ++tx) {
+                m_tileBins[static_cast<std::size_t>(ty) * m_tilesX + tx].push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::RasterizeTile(std::size_t tileIndex) noexcept {
+    const auto tx = static_cast<int>(tileIndex % m_tilesX);
+    const auto ty = static_cast<int>(tileIndex / m_tilesX);
+    const auto min_x = tx * tile_size;
+    const auto min_y = ty * tile_size;
+    const auto max_x = (std::min)(m_width, min_x + tile_size);
+    const auto max_y = (std::min)(m_height, min_y + tile_size);
+    for (auto y = min_y; y < max_y; ++y) {
+        WriteSpan(y, min_x, max_x, m_clearColor);
+    }
+    for (const auto index : m_tileBins[tileIndex]) {
+        const auto& primitive = m_primitives[index];
+        switch (primitive.kind) {
+        case PrimitiveKind::Rect:
+            RasterizeRect(primitive, min_x, min_y, max_x, max_y);
+            break;
+        case PrimitiveKind::Disc:
+            RasterizeDisc(primitive, min_x, min_y, max_x, max_y);
+            break;
+        case PrimitiveKind::Line:
+            RasterizeLine(primitive, min_x, min_y, max_x, max_y);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void SoftwareRasterizer::RasterizeRect(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept {
+    const auto x0 = (std::max)(tileMinX, primitive.minX);
+    const auto x1 = (std::min)(tileMaxX, primitive.maxX);
+    const auto y0 = (std::max)(tileMinY, primitive.minY);
+    const auto y1 = (std::min)(tileMaxY, primitive.maxY);
+    if (x1 <= x0) {
+        return;
+    }
+    for (auto y = y0; y < y1; ++y) {
+        WriteSpan(y, x0, x1, primitive.color);
+    }
+}
+
+void SoftwareRasterizer::RasterizeDisc(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept {
+    const auto& c = primitive.a;
+    const auto r = primitive.b.x;
+    const auto y0 = (std::max)(tileMinY, primitive.minY);
+    const auto y1 = (std::min)(tileMaxY, primitive.maxY);
+    for (auto y = y0; y < y1; ++y) {
+        const auto dy = (static_cast<float>(y) + 0.5f) - c.y;
+        const auto d2 = r * r - dy * dy;
+        if (d2 < 0.0f) {
+            continue;
+        }
+        const auto half_width = std::sqrt(d2);
+        const auto x0 = (std::max)(tileMinX, static_cast<int>(std::ceil(c.x - half_width - 0.5f)));
+        const auto x1 = (std::min)(tileMaxX, static_cast<int>(std::floor(c.x + half_width - 0.5f)) + 1);
+        if (x0 < x1) {
+            WriteSpan(y, x0, x1, primitive.color);
+        }
+    }
+}
+
+void SoftwareRasterizer::RasterizeLine(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept {
+    const auto& a = primitive.a;
+    const auto& b = primitive.b;
+    const auto d = b - a;
+    //Step one pixel at a time along the major axis, visiting only the columns or rows inside this tile.
+    if (std::abs(d.y) <= std::abs(d.x)) {
+        const auto x0 = (std::max)(tileMinX, primitive.minX);
+        const auto x1 = (std::min)(tileMaxX, primitive.maxX);
+        for (auto x = x0; x < x1; ++x) {
+            const auto t = d.x == 0.0f ? 0.0f : std::clamp(((static_cast<float>(x) + 0.5f) - a.x) / d.x, 0.0f, 1.0f);
+            const auto y = static_cast<int>(std::floor(a.y + t * d.y));
+            if (tileMinY <= y && y < tileMaxY) {
+                WriteSpan(y, x, x + 1, primitive.color);
+            }
+        }
+    } else {
+        const auto y0 = (std::max)(tileMinY, primitive.minY);
+        const auto y1 = (std::min)(tileMaxY, primitive.maxY);
+        for (auto y = y0; y < y1; ++y) {
+            const auto t = std::clamp(((static_cast<float>(y) + 0.5f) - a.y) / d.y, 0.0f, 1.0f);
+            const auto x = static_cast<int>(std::floor(a.x + t * d.x));
+            if (tileMinX <= x && x < tileMaxX) {
+                WriteSpan(y, x, x + 1, primitive.color);
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::WriteSpan(int y, int x0, int x1, std::uint32_t color) noexcept {
+    auto* row = m_pixels.data() + static_cast<std::size_t>(y) * static_cast<std::size_t>(m_width);
+    const auto alpha = color >> 24;
+    auto x = x0;
+    if (alpha == 0xFFu) {
+#ifdef MISSILE_RASTER_SSE2
+        const auto fill = _mm_set1_epi32(static_cast<int>(color));
+        for (; x + 4 <= x1; x += 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), fill);
+        }
+#endif
+        std::fill(row + x, row + x1, color);
+        return;
+    }
+    const auto inverse_alpha = 0xFFu - alpha;
+    const auto src_rb = (color & 0x00FF00FFu) * alpha;
+    const auto src_g = ((color >> 8) & 0x000000FFu) * alpha;
+#ifdef MISSILE_RASTER_SSE2
+    const auto red = static_cast<short>((color & 0xFFu) * alpha);
+    const auto green = static_cast<short>(((color >> 8) & 0xFFu) * alpha);
+    const auto blue = static_cast<short>(((color >> 16) & 0xFFu) * alpha);
+    const auto src = _mm_set_epi16(0, blue, green, red, 0, blue, green, red);
+    const auto inverse = _mm_set1_epi16(static_cast<short>(inverse_alpha));
+    const auto bias = _mm_set1_epi16(0x80);
+    const auto opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const auto zero = _mm_setzero_si128();
+    for (; x + 4 <= x1; x += 4) {
+        auto* pixels = reinterpret_cast<__m128i*>(row + x);
+        const auto dst = _mm_loadu_si128(pixels);
+        const auto low = BlendChannels(_mm_unpacklo_epi8(dst, zero), src, inverse, bias);
+        const auto high = BlendChannels(_mm_unpackhi_epi8(dst, zero), src, inverse, bias);
+        _mm_storeu_si128(pixels, _mm_or_si128(_mm_packus_epi16(low, high), opaque));
+    }
+#endif
+    for (; x < x1; ++x) {
+        row[x] = BlendPixel(row[x], src_rb, src_g, inverse_alpha);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class WorkerPool;
+
+//CPU rasterizer for flat-colored 2D primitives, the backend RenderSnapshot::Rasterize draws into.
+//It needs no engine renderer, so RasterScenes runs it headless for golden-image checks and benchmarks.
+//Spans are filled and alpha-blended four pixels at a time with SSE2.
+//Primitives are binned into fixed-size tiles at End and each tile is rasterized independently, so tiles run in parallel
+//while every pixel still sees its primitives in submission order.
+//Pixels are RGBA8, one std::uint32_t each with red in the lowest byte, rows top to bottom.
+class SoftwareRasterizer {
+public:
+    static constexpr const int tile_size{64};
+
+    SoftwareRasterizer() = default;
+    SoftwareRasterizer(const SoftwareRasterizer& other) = default;
+    SoftwareRasterizer(SoftwareRasterizer&& other) = default;
+    SoftwareRasterizer& operator=(const SoftwareRasterizer& other) = default;
+    SoftwareRasterizer& operator=(SoftwareRasterizer&& other) = default;
+    ~SoftwareRasterizer() = default;
+
+    void Resize(int width, int height) noexcept;
+
+    //viewBounds is stretched over the whole framebuffer; larger world y is further down the image.
+    void Begin(const AABB2& viewBounds, const Rgba& clearColor) noexcept;
+    void DrawRect(Vector2 center, Vector2 dimensions, const Rgba& color) noexcept;
+    void DrawFilledCircle(Vector2 center, float radius, const Rgba& color) noexcept;
+    void DrawLine(Vector2 start, Vector2 end, const Rgba& color) noexcept;
+    void DrawPoint(Vector2 position, const Rgba& color) noexcept;
+    //Rasterizes everything drawn since Begin. A null pool or a pool without workers rasterizes on the calling thread.
+    void End(WorkerPool* pool) noexcept;
+
+    int GetWidth() const noexcept;
+    int GetHeight() const noexcept;
+    const std::vector<std::uint32_t>& GetPixels() const noexcept;
+    std::size_t GetPrimitiveCount() const noexcept;
+
+protected:
+private:
+    enum class PrimitiveKind : std::uint8_t {
+        Rect
+        , Disc
+        , Line
+    };
+
+    //Coordinates are in pixels. Rect uses a/b as min/max corners, Disc uses a as center and b.x as radius, Line uses a/b as endpoints.
+    struct Primitive {
+        Vector2 a{};
+        Vector2 b{};
+        std::uint32_t color{};
+        PrimitiveKind kind{PrimitiveKind::Rect};
+        int minX{};
+        int minY{};
+        int maxX{};
+        int maxY{};
+    };
+
+    Vector2 ToPixels(Vector2 worldPosition) const noexcept;
+    void Submit(Primitive primitive) noexcept;
+    void BinPrimitives() noexcept;
+    void RasterizeTile(std::size_t tileIndex) noexcept;
+    void RasterizeRect(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept;
+    void RasterizeDisc(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept;
+    void RasterizeLine(const Primitive& primitive, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) noexcept;
+    void WriteSpan(int y, int x0, int x1, std::uint32_t color) noexcept;
+
+    std::vector<std::uint32_t> m_pixels{};
+    std::vector<Primitive> m_primitives{};
+    std::vector<std::vector<std::uint32_t>> m_tileBins{};
+    AABB2 m_viewBounds{};
+    Vector2 m_scale{};
+    std::uint32_t m_clearColor{};
+    int m_width{0};
+    int m_height{0};
+    int m_tilesX{0};
+    int m_tilesY{0};
+};
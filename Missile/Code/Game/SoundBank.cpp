@@ -0,0 +1,233 @@
+#include "Game/SoundBank.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+
+namespace {
+    constexpr const std::array<char, 4> bank_magic{ 'M', 'S', 'B', 'K' };
+    constexpr const std::uint32_t bank_version{1u};
+    constexpr const std::size_t max_clip_name{48u};
+
+    struct BankHeader {
+        std::array<char, 4> magic{};
+        std::uint32_t version{0u};
+        std::uint32_t clipCount{0u};
+        std::uint32_t reserved{0u};
+    };
+
+    struct BankEntry {
+        std::array<char, max_clip_name> name{};
+        std::uint32_t sampleRate{0u};
+        std::uint32_t channels{0u};
+        std::uint64_t frameCount{0u};
+        std::uint64_t dataOffset{0u};
+    };
+
+    struct DecodedWav {
+        std::string name{};
+        std::vector<float> samples{};
+        std::uint32_t sampleRate{0u};
+        std::uint32_t channels{0u};
+    };
+
+    std::uint32_t ReadLittleEndian16(const unsigned char* bytes) noexcept {
+        return std::uint32_t{bytes[0]} | (std::uint32_t{bytes[1]} << 8);
+    }
+
+    std::uint32_t ReadLittleEndian32(const unsigned char* bytes) noexcept {
+        return ReadLittleEndian16(bytes) | (ReadLittleEndian16(bytes + 2) << 16);
+    }
+
+    float DecodeSample(const unsigned char* bytes, std::uint32_t bitsPerSample, bool isFloat) noexcept {
+        if (isFloat) {
+            auto value = 0.0f;
+            std::memcpy(&value, bytes, sizeof(value));
+            return value;
+        }
+        switch (bitsPerSample) {
+        case 8: return (static_cast<float>(bytes[0]) - 128.0f) / 128.0f;
+        case 16: return static_cast<float>(static_cast<std::int16_t>(ReadLittleEndian16(bytes))) / 32768.0f;
+        case 24: return static_cast<float>(static_cast<std::int32_t>((std::uint32_t{bytes[0]} << 8) | (std::uint32_t{bytes[1]} << 16) | (std::uint32_t{bytes[2]} << 24)) >> 8) / 8388608.0f;
+        case 32: return static_cast<float>(static_cast<std::int32_t>(ReadLittleEndian32(bytes))) / 2147483648.0f;
+        default: return 0.0f;
+        }
+    }
+
+    //Integer PCM of 8 to 32 bits and 32-bit float, plain or WAVE_FORMAT_EXTENSIBLE.
+    bool DecodeWav(const std::filesystem::path& path, DecodedWav& wav) noexcept {
+        std::ifstream file{ path, std::ios::binary };
+        const auto bytes = std::vector<unsigned char>{ std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{} };
+        if (bytes.size() < 12u || std::memcmp(bytes.data(), "RIFF", 4) != 0 || std::memcmp(bytes.data() + 8, "WAVE", 4) != 0) {
+            return false;
+        }
+        auto format = std::uint32_t{0u};
+        auto bits = std::uint32_t{0u};
+        const unsigned char* data{nullptr};
+        auto data_size = std::size_t{0u};
+        for (std::size_t pos = 12u; pos + 8u <= bytes.size();) {
+            const auto* chunk = bytes.data() + pos;
+            const auto size = static_cast<std::size_t>(ReadLittleEndian32(chunk + 4));
+            const auto body = pos + 8u;
+            if (body + size > bytes.size()) {
+                return false;
+            }
+            if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16u) {
+                format = ReadLittleEndian16(chunk + 8);
+                wav.channels = ReadLittleEndian16(chunk + 10);
+                wav.sampleRate = ReadLittleEndian32(chunk + 12);
+                bits = ReadLittleEndian16(chunk + 22);
+                constexpr const std::uint32_t extensible{0xFFFEu};
+                if (format == extensible && size >= 26u) {
+                    //The sub-format GUID starts with the plain format tag.
+                    format = ReadLittleEndian16(chunk + 32);
+                }
+            } else if (std::memcmp(chunk, "data", 4) == 0) {
+                data = chunk + 8;
+                data_size = size;
+            }
+            pos = body + size + (size & 1u);
+        }
+        constexpr const std::uint32_t pcm{1u};
+        constexpr const std::uint32_t ieee_float{3u};
+        const auto is_float = format == ieee_float && bits == 32u;
+        if (data == nullptr || wav.channels == 0u || wav.sampleRate == 0u || !(is_float || (format == pcm && bits >= 8u && bits <= 32u && bits % 8u == 0u))) {
+            return false;
+        }
+        const auto bytes_per_sample = bits / 8u;
+        const auto sample_count = data_size / bytes_per_sample / wav.channels * wav.channels;
+        wav.samples.resize(sample_count);
+        for (std::size_t i = 0u; i < sample_count; ++i) {
+            wav.samples[i] = DecodeSample(data + i * bytes_per_sample, bits, is_float);
+        }
+        wav.name = path.stem().string();
+        return true;
+    }
+
+    std::size_t AlignUp(std::size_t value) noexcept {
+        return (value + SoundBank::data_alignment - 1u) & ~(SoundBank::data_alignment - 1u);
+    }
+
+    std::vector<std::filesystem::path> FindWavFiles(const std::filesystem::path& folder) noexcept {
+        auto paths = std::vector<std::filesystem::path>{};
+        auto ec = std::error_code{};
+        for (const auto& entry : std::filesystem::directory_iterator{ folder, ec }) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".wav") {
+                paths.push_back(entry.path());
+            }
+        }
+        //Directory order is unspecified; sorting keeps the bank byte-identical between builds.
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+}
+
+TimeUtils::FPSeconds SoundClip::GetLength() const noexcept {
+    return sampleRate != 0u ? TimeUtils::FPSeconds{ static_cast<float>(frameCount) / static_cast<float>(sampleRate) } : TimeUtils::FPSeconds::zero();
+}
+
+bool SoundBank::Build(const std::filesystem::path& sourceFolder, const std::filesystem::path& bankPath) noexcept {
+    auto wavs = std::vector<DecodedWav>{};
+    for (const auto& path : FindWavFiles(sourceFolder)) {
+        auto wav = DecodedWav{};
+        if (DecodeWav(path, wav) && wav.name.size() < max_clip_name) {
+            wavs.push_back(std::move(wav));
+        }
+    }
+
+    auto entries = std::vector<BankEntry>(wavs.size());
+    auto offset = AlignUp(sizeof(BankHeader) + sizeof(BankEntry) * entries.size());
+    for (std::size_t i = 0u; i < wavs.size(); ++i) {
+        auto& entry = entries[i];
+        std::copy(wavs[i].name.begin(), wavs[i].name.end(), entry.name.begin());
+        entry.sampleRate = wavs[i].sampleRate;
+        entry.channels = wavs[i].channels;
+        entry.frameCount = wavs[i].samples.size() / wavs[i].channels;
+        entry.dataOffset = offset;
+        offset = AlignUp(offset + wavs[i].samples.size() * sizeof(float));
+    }
+
+    auto error = std::string{};
+    return MappedFile::Write(bankPath, [&wavs, &entries](std::ostream& file) {
+        const auto header = BankHeader{ bank_magic, bank_version, static_cast<std::uint32_t>(entries.size()), 0u };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(sizeof(BankEntry) * entries.size()));
+        constexpr const std::array<char, data_alignment> padding{};
+        auto written = sizeof(BankHeader) + sizeof(BankEntry) * entries.size();
+        for (std::size_t i = 0u; i < wavs.size(); ++i) {
+            file.write(padding.data(), static_cast<std::streamsize>(entries[i].dataOffset - written));
+            const auto size = wavs[i].samples.size() * sizeof(float);
+            file.write(reinterpret_cast<const char*>(wavs[i].samples.data()), static_cast<std::streamsize>(size));
+            written = entries[i].dataOffset + size;
+        }
+    }, error);
+}
+
+bool SoundBank::IsStale(const std::filesystem::path& sourceFolder, const std::filesystem::path& bankPath) noexcept {
+    auto ec = std::error_code{};
+    const auto bank_time = std::filesystem::last_write_time(bankPath, ec);
+    if (ec) {
+        return true;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator{ sourceFolder, ec }) {
+        if (entry.path().extension() == ".wav" && entry.last_write_time(ec) > bank_time) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SoundBank::Open(const std::filesystem::path& bankPath) noexcept {
+    Close();
+    if (!m_file.Open(bankPath)) {
+        return false;
+    }
+    const auto bytes = m_file.GetBytes();
+    auto header = BankHeader{};
+    if (bytes.size() < sizeof(header)) {
+        Close();
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != bank_magic || header.version != bank_version || (bytes.size() - sizeof(header)) / sizeof(BankEntry) < header.clipCount) {
+        Close();
+        return false;
+    }
+    m_clips.reserve(header.clipCount);
+    for (std::uint32_t i = 0u; i < header.clipCount; ++i) {
+        auto entry = BankEntry{};
+        std::memcpy(&entry, bytes.data() + sizeof(header) + sizeof(BankEntry) * i, sizeof(entry));
+        //Divided rather than multiplied so a corrupt entry cannot overflow its way past the check.
+        if (entry.channels == 0u || entry.dataOffset % data_alignment != 0u || bytes.size() < entry.dataOffset || (bytes.size() - entry.dataOffset) / sizeof(float) / entry.channels < entry.frameCount) {
+            Close();
+            return false;
+        }
+        const auto sample_count = entry.frameCount * entry.channels;
+        const auto* name = reinterpret_cast<const char*>(bytes.data() + sizeof(header) + sizeof(BankEntry) * i);
+        const auto* samples = reinterpret_cast<const float*>(bytes.data() + entry.dataOffset);
+        m_clips.push_back(SoundClip{ std::string_view{ name, static_cast<std::size_t>(std::find(name, name + max_clip_name, '\0') - name) }, std::span<const float>{ samples, static_cast<std::size_t>(sample_count) }, entry.sampleRate, entry.channels, entry.frameCount });
+    }
+    return true;
+}
+
+void SoundBank::Close() noexcept {
+    m_clips.clear();
+    m_file.Close();
+}
+
+bool SoundBank::IsOpen() const noexcept {
+    return m_file.IsOpen();
+}
+
+const SoundClip* SoundBank::Find(std::string_view name) const noexcept {
+    const auto found = std::find_if(m_clips.begin(), m_clips.end(), [name](const SoundClip& clip) { return clip.name == name; });
+    return found != m_clips.end() ? &*found : nullptr;
+}
+
+std::span<const SoundClip> SoundBank::GetClips() const noexcept {
+    return m_clips;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Game/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//Decoded PCM for one sound, pointing into the mapped bank.
+struct SoundClip {
+    std::string_view name{};
+    //Interleaved float samples in [-1, 1], channels per frame.
+    std::span<const float> samples{};
+    std::uint32_t sampleRate{0u};
+    std::uint32_t channels{0u};
+    std::uint64_t frameCount{0u};
+
+    TimeUtils::FPSeconds GetLength() const noexcept;
+};
+
+//Every game sound packed into one file of pre-decoded float PCM, each clip aligned to data_alignment.
+//Open maps the file and reads only the header; sample pages are faulted in when first played.
+class SoundBank {
+public:
+    static constexpr const std::size_t data_alignment{64u};
+
+    SoundBank() = default;
+    SoundBank(const SoundBank& other) = delete;
+    SoundBank(SoundBank&& other) = delete;
+    SoundBank& operator=(const SoundBank& other) = delete;
+    SoundBank& operator=(SoundBank&& other) = delete;
+    ~SoundBank() = default;
+
+    //Decodes every .wav in sourceFolder into a bank at bankPath. Clips are named after the file stem.
+    static bool Build(const std::filesystem::path& sourceFolder, const std::filesystem::path& bankPath) noexcept;
+    //True if bankPath is missing or older than any .wav in sourceFolder. Only reads directory entries.
+    static bool IsStale(const std::filesystem::path& sourceFolder, const std::filesystem::path& bankPath) noexcept;
+
+    //Returns false, leaving the bank empty, if the file is missing or malformed.
+    bool Open(const std::filesystem::path& bankPath) noexcept;
+    void Close() noexcept;
+    bool IsOpen() const noexcept;
+
+    const SoundClip* Find(std::string_view name) const noexcept;
+    std::span<const SoundClip> GetClips() const noexcept;
+
+protected:
+private:
+    MappedFile m_file{};
+    std::vector<SoundClip> m_clips{};
+};
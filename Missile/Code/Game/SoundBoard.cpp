@@ -0,0 +1,201 @@
+#include "Game/SoundBoard.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Game/GameCommon.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace {
+    struct SoundInfo {
+        std::string_view stem{};
+        //Files are named stem0.wav, stem1.wav, ...; zero means a single stem.wav.
+        int variants{0};
+        std::size_t maxVoices{1u};
+    };
+
+    constexpr const std::array<SoundInfo, SoundBoard::sound_count> sound_table{
+        SoundInfo{ "LaunchMissile", GameConstants::max_launch_sounds, 4u }
+        , SoundInfo{ "Explosion", GameConstants::max_explosion_sounds, 6u }
+        , SoundInfo{ "Klaxon", 0, 1u }
+        , SoundInfo{ "Bomber", 0, 2u }
+        , SoundInfo{ "Satellite", 0, 2u }
+        , SoundInfo{ "NoMissiles", 0, 1u }
+        , SoundInfo{ "LowMissiles", 0, 1u }
+        , SoundInfo{ "Counting", 0, 1u }
+        , SoundInfo{ "BonusCity", 0, 1u }
+    };
+
+    std::string GetVariantName(const SoundInfo& info, int variant) noexcept {
+        return info.variants != 0 ? std::format("{}{}", info.stem, variant) : std::string{ info.stem };
+    }
+
+    std::uint32_t ReadLittleEndian(const unsigned char* bytes) noexcept {
+        return std::uint32_t{bytes[0]} | (std::uint32_t{bytes[1]} << 8) | (std::uint32_t{bytes[2]} << 16) | (std::uint32_t{bytes[3]} << 24);
+    }
+
+    //Length of a PCM wav file from its fmt and data chunks, or zero if the header cannot be read.
+    TimeUtils::FPSeconds ReadWavLength(const std::filesystem::path& path) noexcept {
+        std::ifstream file{ path, std::ios::binary };
+        unsigned char riff[12]{};
+        if (!file.read(reinterpret_cast<char*>(riff), sizeof(riff)) || std::string_view{ reinterpret_cast<const char*>(riff), 4 } != "RIFF" || std::string_view{ reinterpret_cast<const char*>(riff + 8), 4 } != "WAVE") {
+            return TimeUtils::FPSeconds::zero();
+        }
+        auto byte_rate = std::uint32_t{0u};
+        unsigned char header[8]{};
+        while (file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+            const auto id = std::string_view{ reinterpret_cast<const char*>(header), 4 };
+            const auto size = ReadLittleEndian(header + 4);
+            if (id == "fmt ") {
+                unsigned char format[16]{};
+                if (size < sizeof(format) || !file.read(reinterpret_cast<char*>(format), sizeof(format))) {
+                    return TimeUtils::FPSeconds::zero();
+                }
+                byte_rate = ReadLittleEndian(format + 8);
+                file.seekg(static_cast<std::streamoff>(size - sizeof(format) + (size & 1u)), std::ios::cur);
+            } else if (id == "data") {
+                return byte_rate != 0u ? TimeUtils::FPSeconds{ static_cast<float>(size) / static_cast<float>(byte_rate) } : TimeUtils::FPSeconds::zero();
+            } else {
+                file.seekg(static_cast<std::streamoff>(size + (size & 1u)), std::ios::cur);
+            }
+        }
+        return TimeUtils::FPSeconds::zero();
+    }
+}
+
+void SoundBoard::Load(const SoundBank& bank, SoftwareMixer* mixer) noexcept {
+    m_mixer = mixer;
+    for (std::size_t i = 0u; i < sound_count; ++i) {
+        const auto& info = sound_table[i];
+        auto& sound = m_sounds[i];
+        sound.variants.clear();
+        sound.nextVariant = 0u;
+        sound.maxVoices = info.maxVoices;
+        const auto variant_count = (std::max)(info.variants, 1);
+        for (int v = 0; v < variant_count; ++v) {
+            const auto name = GetVariantName(info, v);
+            auto path = GameConstants::game_audio_folder / std::filesystem::path{ name + ".wav" };
+            if (m_mixer == nullptr) {
+                g_theAudioSystem->RegisterWavFile(path);
+            }
+            const auto* clip = bank.Find(name);
+            auto length = clip != nullptr ? clip->GetLength() : ReadWavLength(path);
+            if (length <= TimeUtils::FPSeconds::zero()) {
+                g_theFileLogger->LogWarnLine(std::format("Could not read the length of {}; assuming {} seconds.", path.string(), GameConstants::sound_fallback_length_seconds));
+                length = TimeUtils::FPSeconds{ GameConstants::sound_fallback_length_seconds };
+            }
+            sound.variants.push_back(Variant{ std::move(path), clip, length });
+        }
+    }
+}
+
+std::size_t SoundBoard::GetMaxVoices(SoundId id) noexcept {
+    return id < SoundId::Max ? sound_table[static_cast<std::size_t>(id)].maxVoices : 0u;
+}
+
+std::string SoundBoard::GetClipName(SoundId id) noexcept {
+    return id < SoundId::Max ? GetVariantName(sound_table[static_cast<std::size_t>(id)], 0) : std::string{};
+}
+
+bool SoundBoard::Request(SoundId id, const AudioSystem::SoundDesc& desc) noexcept {
+    if (!m_commands.TryPush(Command{ id, desc })) {
+        ++m_dropped;
+        return false;
+    }
+    return true;
+}
+
+void SoundBoard::Flush() noexcept {
+    auto command = Command{};
+    while (m_commands.TryPop(command)) {
+        Merge(command);
+    }
+    PlayPending();
+}
+
+std::uint64_t SoundBoard::GetPlayedCount() const noexcept {
+    return m_played.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SoundBoard::GetMergedCount() const noexcept {
+    return m_merged.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SoundBoard::GetStolenCount() const noexcept {
+    return m_stolen.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SoundBoard::GetLimitedCount() const noexcept {
+    return m_limited.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SoundBoard::GetDroppedCount() const noexcept {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+std::uint64_t SoundBoard::GetBatchCount() const noexcept {
+    return m_batches.load(std::memory_order_relaxed);
+}
+
+void SoundBoard::Merge(const Command& command) noexcept {
+    auto& pending = m_pending[static_cast<std::size_t>(command.id)];
+    if (!pending.requested) {
+        pending.desc = command.desc;
+        pending.requested = true;
+        return;
+    }
+    pending.desc.volume = (std::min)(pending.desc.volume + command.desc.volume, GameConstants::sound_max_merged_volume);
+    ++m_merged;
+}
+
+void SoundBoard::PlayPending() noexcept {
+    const auto now = TimeUtils::Now();
+    std::erase_if(m_voices, [now](const Voice& voice) { return voice.end <= now; });
+    for (std::size_t i = 0u; i < sound_count; ++i) {
+        auto& pending = m_pending[i];
+        if (!pending.requested) {
+            continue;
+        }
+        pending.requested = false;
+        auto& sound = m_sounds[i];
+        if (sound.variants.empty()) {
+            continue;
+        }
+        const auto id = static_cast<SoundId>(i);
+        const auto is_this_sound = [id](const Voice& voice) { return voice.id == id; };
+        if (static_cast<std::size_t>(std::count_if(m_voices.begin(), m_voices.end(), is_this_sound)) >= sound.maxVoices) {
+            //The engine cannot stop a voice, so taking one over would only add a voice past the cap.
+            if (m_mixer == nullptr) {
+                ++m_limited;
+                continue;
+            }
+            //Voices are appended in start order, so the first match is the oldest.
+            const auto oldest = std::find_if(m_voices.begin(), m_voices.end(), is_this_sound);
+            m_mixer->Stop(oldest->mixerVoice);
+            m_voices.erase(oldest);
+            ++m_stolen;
+        }
+        const auto& variant = sound.variants[sound.nextVariant];
+        sound.nextVariant = (sound.nextVariant + 1u) % sound.variants.size();
+        auto mixer_voice = SoftwareMixer::invalid_voice;
+        auto length = variant.length;
+        if (m_mixer == nullptr) {
+            g_theAudioSystem->Play(variant.path, pending.desc);
+        } else {
+            mixer_voice = variant.clip != nullptr ? m_mixer->Start(*variant.clip, pending.desc.volume, pending.desc.frequency, pending.desc.loopCount) : SoftwareMixer::invalid_voice;
+            if (mixer_voice == SoftwareMixer::invalid_voice) {
+                continue;
+            }
+            //The mixer plays exactly the clip's frames at this rate, so the voice ends within a block of this time.
+            length /= pending.desc.frequency;
+        }
+        const auto plays = static_cast<float>(pending.desc.loopCount + 1);
+        m_voices.push_back(Voice{ id, now, now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(length * plays), mixer_voice });
+        ++m_played;
+    }
+    ++m_batches;
+}
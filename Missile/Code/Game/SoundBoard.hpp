@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Engine/Audio/AudioSystem.hpp"
+
+#include "Engine/Core/TimeUtils.hpp"
+
+#include "Game/EventRing.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/SoftwareMixer.hpp"
+#include "Game/SoundBank.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+enum class SoundId : std::uint8_t {
+    LaunchMissile
+    , Explosion
+    , Klaxon
+    , Bomber
+    , Satellite
+    , NoMissiles
+    , LowMissiles
+    , Counting
+    , BonusCity
+    , Max
+};
+
+//Game sounds resolved to handles once at startup and played with a bounded number of voices.
+//Request only pushes to a lock-free command queue, so no audio work happens where a sound is triggered.
+//Flush drains the queue on the game thread, merges and limits, and starts the voices in the same frame they were requested.
+//Requests between two Flush calls form one batch: repeats in a batch become one voice with their volumes summed.
+//Given a software mixer, sounds play from the bank through it: a voice ends when the mixer has played the clip's frames,
+//and a sound at its cap stops its oldest voice to make room.
+//The engine fallback plays by path and reports nothing back, so its voice lifetimes are estimated from each file's length.
+//It cannot stop a single voice either, so there a sound at its cap drops the new request instead of stealing.
+class SoundBoard {
+public:
+    static constexpr const std::size_t sound_count{static_cast<std::size_t>(SoundId::Max)};
+
+    SoundBoard() = default;
+    SoundBoard(const SoundBoard& other) = delete;
+    SoundBoard(SoundBoard&& other) = delete;
+    SoundBoard& operator=(const SoundBoard& other) = delete;
+    SoundBoard& operator=(SoundBoard&& other) = delete;
+    ~SoundBoard() noexcept = default;
+
+    //Registers every game sound with the audio system.
+    //Lengths come from the bank; a sound missing from it falls back to reading its wav header.
+    //With a non-null mixer the engine is bypassed and sounds missing from the bank stay silent. The mixer must outlive the board.
+    void Load(const SoundBank& bank, SoftwareMixer* mixer) noexcept;
+
+    static std::size_t GetMaxVoices(SoundId id) noexcept;
+    //Bank name of the sound's first variant.
+    static std::string GetClipName(SoundId id) noexcept;
+
+    //Safe from any thread. Returns false if the command queue is full and the request was dropped.
+    bool Request(SoundId id, const AudioSystem::SoundDesc& desc) noexcept;
+    //Game thread only. Plays everything requested since the last Flush as one batch.
+    void Flush() noexcept;
+
+    std::uint64_t GetPlayedCount() const noexcept;
+    std::uint64_t GetMergedCount() const noexcept;
+    std::uint64_t GetStolenCount() const noexcept;
+    //Requests dropped because their sound was at its voice cap and no voice could be stopped.
+    std::uint64_t GetLimitedCount() const noexcept;
+    std::uint64_t GetDroppedCount() const noexcept;
+    std::uint64_t GetBatchCount() const noexcept;
+
+protected:
+private:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    struct Command {
+        SoundId id{SoundId::Max};
+        AudioSystem::SoundDesc desc{};
+    };
+
+    struct Variant {
+        std::filesystem::path path{};
+        const SoundClip* clip{nullptr};
+        TimeUtils::FPSeconds length{};
+    };
+    struct Sound {
+        std::vector<Variant> variants{};
+        std::size_t nextVariant{0u};
+        std::size_t maxVoices{1u};
+    };
+    struct Pending {
+        AudioSystem::SoundDesc desc{};
+        bool requested{false};
+    };
+    struct Voice {
+        SoundId id{SoundId::Max};
+        TimePoint start{};
+        TimePoint end{};
+        SoftwareMixer::VoiceId mixerVoice{SoftwareMixer::invalid_voice};
+    };
+
+    void Merge(const Command& command) noexcept;
+    void PlayPending() noexcept;
+
+    std::array<Sound, sound_count> m_sounds{};
+    SoftwareMixer* m_mixer{nullptr};
+    //Game thread only.
+    std::array<Pending, sound_count> m_pending{};
+    std::vector<Voice> m_voices{};
+    EventRing<Command, GameConstants::sound_command_capacity> m_commands{};
+    std::atomic<std::uint64_t> m_played{0u};
+    std::atomic<std::uint64_t> m_merged{0u};
+    std::atomic<std::uint64_t> m_stolen{0u};
+    std::atomic<std::uint64_t> m_limited{0u};
+    std::atomic<std::uint64_t> m_dropped{0u};
+    std::atomic<std::uint64_t> m_batches{0u};
+};
@@ -0,0 +1,65 @@
+#include "Game/SpriteBatcher.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+void SpriteBatcher::Begin() noexcept {
+    m_materials.clear();
+    m_quads.clear();
+}
+
+void SpriteBatcher::Add(Material* material, Vector2 position, Vector2 dimensions, const Rgba& color) noexcept {
+    const auto found = std::find(std::cbegin(m_materials), std::cend(m_materials), material);
+    const auto material_index = static_cast<std::size_t>(std::distance(std::cbegin(m_materials), found));
+    if (found == std::cend(m_materials)) {
+        m_materials.push_back(material);
+    }
+    m_quads.push_back(Quad{position, dimensions * 0.5f, color, material_index});
+}
+
+void SpriteBatcher::Flush() noexcept {
+    if (m_quads.empty()) {
+        return;
+    }
+    m_builder.Clear();
+    Build(m_builder);
+    g_theRenderer->SetModelMatrix();
+    Mesh::Render(m_builder);
+}
+
+void SpriteBatcher::Build(Mesh::Builder& builder) const noexcept {
+    //Few materials and small quad counts, so a pass per material beats sorting.
+    for (std::size_t material_index = 0u; material_index < m_materials.size(); ++material_index) {
+        builder.Begin(PrimitiveType::Triangles);
+        for (const auto& quad : m_quads) {
+            if (quad.materialIndex != material_index) {
+                continue;
+            }
+            const auto& p = quad.position;
+            const auto& e = quad.halfExtents;
+            builder.SetColor(quad.color);
+            builder.SetUV(Vector2{ 0.0f, 1.0f });
+            builder.AddVertex(p + Vector2{ -e.x, +e.y });
+            builder.SetUV(Vector2{ 0.0f, 0.0f });
+            builder.AddVertex(p + Vector2{ -e.x, -e.y });
+            builder.SetUV(Vector2{ 1.0f, 0.0f });
+            builder.AddVertex(p + Vector2{ +e.x, -e.y });
+            builder.SetUV(Vector2{ 1.0f, 1.0f });
+            builder.AddVertex(p + Vector2{ +e.x, +e.y });
+            builder.AddIndicies(Mesh::Builder::Primitive::Quad);
+        }
+        builder.End(m_materials[material_index]);
+    }
+}
+
+std::size_t SpriteBatcher::GetQuadCount() const noexcept {
+    return m_quads.size();
+}
+
+std::size_t SpriteBatcher::GetMaterialCount() const noexcept {
+    return m_materials.size();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Engine/Core/Rgba.hpp"
+
+#include "Engine/Math/Vector2.hpp"
+
+#include "Engine/Renderer/Mesh.hpp"
+
+#include <cstddef>
+#include <vector>
+
+class Material;
+
+//Collects axis-aligned textured quads and submits them as one draw per material.
+//Materials are drawn in the order they were first added; quads sharing a material keep their insertion order.
+class SpriteBatcher {
+public:
+    SpriteBatcher() = default;
+    SpriteBatcher(const SpriteBatcher& other) = default;
+    SpriteBatcher(SpriteBatcher&& other) = default;
+    SpriteBatcher& operator=(const SpriteBatcher& other) = default;
+    SpriteBatcher& operator=(SpriteBatcher&& other) = default;
+    ~SpriteBatcher() = default;
+
+    void Begin() noexcept;
+    void Add(Material* material, Vector2 position, Vector2 dimensions, const Rgba& color) noexcept;
+    //Renders everything added since Begin.
+    void Flush() noexcept;
+    //Appends one range per material to builder without rendering, for callers that keep the geometry across frames.
+    void Build(Mesh::Builder& builder) const noexcept;
+
+    std::size_t GetQuadCount() const noexcept;
+    std::size_t GetMaterialCount() const noexcept;
+
+protected:
+private:
+    struct Quad {
+        Vector2 position{};
+        Vector2 halfExtents{};
+        Rgba color{};
+        std::size_t materialIndex{0u};
+    };
+
+    std::vector<Material*> m_materials{};
+    std::vector<Quad> m_quads{};
+    Mesh::Builder m_builder{};
+};
@@ -0,0 +1,41 @@
+#include "Game/StaticSceneLayer.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#include "Engine/Renderer/Renderer.hpp"
+
+#include "Game/RenderHandles.hpp"
+#include "Game/RenderSnapshot.hpp"
+
+bool StaticSceneLayer::IsStale(std::uint32_t generation) const noexcept {
+    return m_generation != generation;
+}
+
+void StaticSceneLayer::Rebuild(const RenderSnapshot& snapshot, const RenderHandles& handles, const AABB2& ground) noexcept {
+    m_batcher.Begin();
+    m_batcher.Add(handles.GetFlatMaterial(), ground.CalcCenter(), ground.CalcDimensions(), snapshot.groundColor);
+    const auto& base_sprite = handles.GetSprite(SpriteId::Base);
+    for (const auto& base : snapshot.bases) {
+        m_batcher.Add(base_sprite.material, base.position, base_sprite.dimensions, base.baseColor);
+    }
+    const auto& city_sprite = handles.GetSprite(SpriteId::City);
+    for (const auto& city : snapshot.cities) {
+        m_batcher.Add(city_sprite.material, city.position, city_sprite.dimensions, city.color);
+    }
+    m_rangeMaterials = { handles.GetFlatMaterial(), base_sprite.material, city_sprite.material };
+    m_rangeQuads = { 1u, snapshot.bases.size(), snapshot.cities.size() };
+    m_builder.Clear();
+    m_batcher.Build(m_builder);
+    m_generation = snapshot.staticSceneGeneration;
+}
+
+void StaticSceneLayer::Render(RenderStats& stats) const noexcept {
+    g_theRenderer->SetModelMatrix();
+    Mesh::Render(m_builder);
+    constexpr const std::array sources{ RenderSubsystem::Ground, RenderSubsystem::Bases, RenderSubsystem::Cities };
+    for (std::size_t i = 0u; i < sources.size(); ++i) {
+        if (m_rangeQuads[i] != 0u) {
+            stats.AddRange(sources[i], m_rangeMaterials[i], m_rangeQuads[i] * 4u, m_rangeQuads[i] * 6u);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Math/AABB2.hpp"
+
+#include "Engine/Renderer/Mesh.hpp"
+
+#include "Game/RenderStats.hpp"
+#include "Game/SpriteBatcher.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+class Material;
+class RenderHandles;
+struct RenderSnapshot;
+
+//Ground, base and city quads kept in one mesh between frames.
+//The mesh is rebuilt only when the snapshot carries a newer static scene generation than the one it was built from.
+class StaticSceneLayer {
+public:
+    StaticSceneLayer() = default;
+    StaticSceneLayer(const StaticSceneLayer& other) = default;
+    StaticSceneLayer(StaticSceneLayer&& other) = default;
+    StaticSceneLayer& operator=(const StaticSceneLayer& other) = default;
+    StaticSceneLayer& operator=(StaticSceneLayer&& other) = default;
+    ~StaticSceneLayer() = default;
+
+    bool IsStale(std::uint32_t generation) const noexcept;
+    void Rebuild(const RenderSnapshot& snapshot, const RenderHandles& handles, const AABB2& ground) noexcept;
+    void Render(RenderStats& stats) const noexcept;
+
+protected:
+private:
+    SpriteBatcher m_batcher{};
+    Mesh::Builder m_builder{};
+    //One range each for ground, bases and cities, in the order the batcher builds them.
+    std::array<const Material*, 3> m_rangeMaterials{};
+    std::array<std::size_t, 3> m_rangeQuads{};
+    std::uint32_t m_generation{0u};
+};
@@ -0,0 +1,36 @@
+#include "Game/TargetTable.hpp"
+
+#include <algorithm>
+
+void TargetTable::SetPosition(std::size_t index, Vector2 position) noexcept {
+    m_positions[index] = position;
+}
+
+void TargetTable::SetWeight(std::size_t index, float weight) noexcept {
+    weight = (std::max)(weight, 0.0f);
+    if (m_weights[index] == weight) {
+        return;
+    }
+    m_weights[index] = weight;
+    auto total = index != 0u ? m_runningTotals[index - 1u] : 0.0f;
+    for (std::size_t i = index; i < max_targets; ++i) {
+        total += m_weights[i];
+        m_runningTotals[i] = total;
+    }
+}
+
+Vector2 TargetTable::Pick(float unitRandom) const noexcept {
+    const auto total = m_runningTotals.back();
+    if (total <= 0.0f) {
+        const auto index = static_cast<std::size_t>(unitRandom * static_cast<float>(max_targets));
+        return m_positions[(std::min)(index, max_targets - 1u)];
+    }
+    //upper_bound skips zero-weight entries, whose running total equals the previous one.
+    const auto found = std::upper_bound(m_runningTotals.begin(), m_runningTotals.end(), unitRandom * total);
+    if (found == m_runningTotals.end()) {
+        //Rounding put the draw on the grand total; fall back to the last entry with any weight.
+        const auto last = std::find_if(m_weights.rbegin(), m_weights.rend(), [](float weight) { return weight > 0.0f; });
+        return m_positions[static_cast<std::size_t>(m_weights.rend() - last) - 1u];
+    }
+    return m_positions[static_cast<std::size_t>(found - m_runningTotals.begin())];
+}
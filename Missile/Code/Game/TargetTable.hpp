@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Engine/Math/Vector2.hpp"
+
+#include <array>
+#include <cstddef>
+
+//Where enemy missiles may be aimed, each with a selection weight.
+//Weights change only when a target is destroyed or rebuilt, so a pick is a binary search over running totals
+//that are patched from the changed entry onward instead of rebuilt from the world.
+class TargetTable {
+public:
+    static constexpr const std::size_t max_targets{9u};
+
+    void SetPosition(std::size_t index, Vector2 position) noexcept;
+    void SetWeight(std::size_t index, float weight) noexcept;
+
+    //unitRandom is in [0, 1). With every weight at zero all targets are equally likely, so a lost game still has somewhere to aim.
+    Vector2 Pick(float unitRandom) const noexcept;
+
+protected:
+private:
+    std::array<Vector2, max_targets> m_positions{};
+    std::array<float, max_targets> m_weights{};
+    //m_runningTotals[i] is the sum of m_weights[0..i].
+    std::array<float, max_targets> m_runningTotals{};
+};
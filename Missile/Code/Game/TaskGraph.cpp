@@ -0,0 +1,72 @@
+#include "Game/TaskGraph.hpp"
+
+#include "Game/WorkerPool.hpp"
+
+#include <utility>
+
+std::size_t TaskGraph::AddNode(std::string name, ResourceMask reads, ResourceMask writes, std::function<void()> work) noexcept {
+    const auto index = m_nodes.size();
+    auto dependency_count = 0;
+    for (auto& earlier : m_nodes) {
+        const auto write_after_any = (earlier.reads | earlier.writes) & writes;
+        const auto read_after_write = earlier.writes & reads;
+        if (write_after_any != 0u || read_after_write != 0u) {
+            earlier.successors.push_back(index);
+            ++dependency_count;
+        }
+    }
+    m_nodes.emplace_back(Node{ std::move(name), reads, writes, std::move(work), {}, dependency_count });
+    m_pending = std::vector<std::atomic<int>>(m_nodes.size());
+    return index;
+}
+
+void TaskGraph::Clear() noexcept {
+    m_nodes.clear();
+    m_pending.clear();
+}
+
+void TaskGraph::Run(WorkerPool* pool) noexcept {
+    if (m_nodes.empty()) {
+        return;
+    }
+    if (pool == nullptr || pool->GetWorkerCount() == 0u) {
+        for (auto& node : m_nodes) {
+            node.work();
+        }
+        return;
+    }
+    for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+        m_pending[i].store(m_nodes[i].dependencyCount, std::memory_order_relaxed);
+    }
+    std::latch remaining{ static_cast<std::ptrdiff_t>(m_nodes.size()) };
+    for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+        if (m_nodes[i].dependencyCount == 0) {
+            Dispatch(*pool, i, remaining);
+        }
+    }
+    pool->HelpUntil(remaining);
+}
+
+void TaskGraph::Dispatch(WorkerPool& pool, std::size_t index, std::latch& remaining) noexcept {
+    pool.Submit([this, &pool, &remaining, index]() {
+        m_nodes[index].work();
+        for (const auto successor : m_nodes[index].successors) {
+            if (m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Dispatch(pool, successor, remaining);
+            }
+        }
+        remaining.count_down();
+    });
+}
+
+std::size_t TaskGraph::GetNodeCount() const noexcept {
+    return m_nodes.size();
+}
+
+const std::string& TaskGraph::GetNodeName(std::size_t index) const noexcept {
+    return m_nodes[index].name;
+}
+
+const std::vector<std::size_t>& TaskGraph::GetSuccessors(std::size_t index) const noexcept {
+    return m_nodes[index].successors;
+}
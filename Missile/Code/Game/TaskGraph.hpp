@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <string>
+#include <vector>
+
+class WorkerPool;
+
+class TaskGraph {
+public:
+    using ResourceMask = std::uint32_t;
+
+    TaskGraph() = default;
+    TaskGraph(const TaskGraph& other) = delete;
+    TaskGraph(TaskGraph&& other) = default;
+    TaskGraph& operator=(const TaskGraph& other) = delete;
+    TaskGraph& operator=(TaskGraph&& other) = default;
+    ~TaskGraph() = default;
+
+    //Nodes run in insertion order when serial. A node depends on every earlier node whose reads or writes conflict with its own.
+    std::size_t AddNode(std::string name, ResourceMask reads, ResourceMask writes, std::function<void()> work) noexcept;
+    void Clear() noexcept;
+
+    //Runs every node once. A null pool or a pool without workers runs the nodes serially on the calling thread.
+    void Run(WorkerPool* pool) noexcept;
+
+    std::size_t GetNodeCount() const noexcept;
+    const std::string& GetNodeName(std::size_t index) const noexcept;
+    const std::vector<std::size_t>& GetSuccessors(std::size_t index) const noexcept;
+
+protected:
+private:
+    struct Node {
+        std::string name{};
+        ResourceMask reads{};
+        ResourceMask writes{};
+        std::function<void()> work{};
+        std::vector<std::size_t> successors{};
+        int dependencyCount{0};
+    };
+
+    void Dispatch(WorkerPool& pool, std::size_t index, std::latch& remaining) noexcept;
+
+    std::vector<Node> m_nodes{};
+    std::vector<std::atomic<int>> m_pending{};
+};
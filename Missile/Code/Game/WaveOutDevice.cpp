@@ -0,0 +1,121 @@
+#include "Game/WaveOutDevice.hpp"
+
+#include "Game/SoftwareMixer.hpp"
+
+#include <array>
+
+#ifdef _WIN32
+#include "Engine/Platform/Win.hpp"
+
+#include <mmsystem.h>
+#include <mmreg.h>
+
+#pragma comment(lib, "winmm.lib")
+#endif
+
+WaveOutDevice::~WaveOutDevice() noexcept {
+    Stop();
+}
+
+bool WaveOutDevice::IsRunning() const noexcept {
+    return m_thread.joinable();
+}
+
+std::uint64_t WaveOutDevice::GetBlockCount() const noexcept {
+    return m_blocks.load(std::memory_order_relaxed);
+}
+
+std::uint64_t WaveOutDevice::GetUnderrunCount() const noexcept {
+    return m_underruns.load(std::memory_order_relaxed);
+}
+
+#ifdef _WIN32
+
+bool WaveOutDevice::Start(SoftwareMixer& mixer) noexcept {
+    Stop();
+    auto format = WAVEFORMATEX{};
+    format.wFormatTag = WAVE_FORMAT_IEEE_FLOAT;
+    format.nChannels = static_cast<WORD>(SoftwareMixer::output_channels);
+    format.nSamplesPerSec = mixer.GetOutputRate();
+    format.wBitsPerSample = static_cast<WORD>(sizeof(float) * 8u);
+    format.nBlockAlign = static_cast<WORD>(SoftwareMixer::output_channels * sizeof(float));
+    format.nAvgBytesPerSec = format.nSamplesPerSec * format.nBlockAlign;
+    auto* event = ::CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if (event == nullptr) {
+        return false;
+    }
+    auto device = HWAVEOUT{};
+    if (::waveOutOpen(&device, WAVE_MAPPER, &format, reinterpret_cast<DWORD_PTR>(event), 0u, CALLBACK_EVENT) != MMSYSERR_NOERROR) {
+        ::CloseHandle(event);
+        return false;
+    }
+    m_device = device;
+    m_event = event;
+    m_blocks = 0u;
+    m_underruns = 0u;
+    m_thread = std::jthread([this, &mixer](std::stop_token stopToken) { this->DeviceLoop(stopToken, mixer); });
+    return true;
+}
+
+void WaveOutDevice::Stop() noexcept {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    m_thread.request_stop();
+    ::SetEvent(static_cast<HANDLE>(m_event));
+    m_thread.join();
+    ::waveOutClose(static_cast<HWAVEOUT>(m_device));
+    ::CloseHandle(static_cast<HANDLE>(m_event));
+    m_device = nullptr;
+    m_event = nullptr;
+}
+
+void WaveOutDevice::DeviceLoop(std::stop_token stopToken, SoftwareMixer& mixer) noexcept {
+    auto* device = static_cast<HWAVEOUT>(m_device);
+    auto buffers = std::array<std::array<float, SoftwareMixer::block_samples>, buffer_count>{};
+    auto headers = std::array<WAVEHDR, buffer_count>{};
+    for (std::size_t i = 0u; i < buffer_count; ++i) {
+        headers[i].lpData = reinterpret_cast<LPSTR>(buffers[i].data());
+        headers[i].dwBufferLength = static_cast<DWORD>(sizeof(buffers[i]));
+        ::waveOutPrepareHeader(device, &headers[i], sizeof(WAVEHDR));
+        mixer.MixBlock(buffers[i]);
+        ::waveOutWrite(device, &headers[i], sizeof(WAVEHDR));
+        ++m_blocks;
+    }
+    //The device returns blocks in the order they were written, so refilling from a cursor keeps them in sequence.
+    auto next = std::size_t{0u};
+    while (!stopToken.stop_requested()) {
+        ::WaitForSingleObject(static_cast<HANDLE>(m_event), INFINITE);
+        auto refilled = std::size_t{0u};
+        while (!stopToken.stop_requested() && (headers[next].dwFlags & WHDR_DONE) != 0u) {
+            mixer.MixBlock(buffers[next]);
+            ::waveOutWrite(device, &headers[next], sizeof(WAVEHDR));
+            ++m_blocks;
+            ++refilled;
+            next = (next + 1u) % buffer_count;
+        }
+        if (refilled == buffer_count) {
+            ++m_underruns;
+        }
+    }
+    //Reset hands back every queued block so the headers can be released before the buffers go away.
+    ::waveOutReset(device);
+    for (auto& header : headers) {
+        ::waveOutUnprepareHeader(device, &header, sizeof(WAVEHDR));
+    }
+}
+
+#else
+
+bool WaveOutDevice::Start([[maybe_unused]] SoftwareMixer& mixer) noexcept {
+    return false;
+}
+
+void WaveOutDevice::Stop() noexcept {
+    m_thread = std::jthread{};
+}
+
+void WaveOutDevice::DeviceLoop([[maybe_unused]] std::stop_token stopToken, [[maybe_unused]] SoftwareMixer& mixer) noexcept {
+}
+
+#endif
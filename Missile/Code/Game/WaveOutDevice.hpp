@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+#include <thread>
+
+class SoftwareMixer;
+
+//Plays the software mixer through the default wave output device.
+//A small ring of mixer blocks is queued with the device; the device thread refills each block as the device hands it back.
+//If every block comes back in one wake-up the device has run dry and played a gap, so that is counted as an underrun.
+class WaveOutDevice {
+public:
+    static constexpr const std::size_t buffer_count{6u};
+
+    WaveOutDevice() = default;
+    WaveOutDevice(const WaveOutDevice& other) = delete;
+    WaveOutDevice(WaveOutDevice&& other) = delete;
+    WaveOutDevice& operator=(const WaveOutDevice& other) = delete;
+    WaveOutDevice& operator=(WaveOutDevice&& other) = delete;
+    ~WaveOutDevice() noexcept;
+
+    //Returns false, leaving nothing running, if there is no output device or it rejects the mixer's format.
+    //Always false off Windows. The mixer must outlive the device or the next Stop.
+    bool Start(SoftwareMixer& mixer) noexcept;
+    void Stop() noexcept;
+    bool IsRunning() const noexcept;
+
+    std::uint64_t GetBlockCount() const noexcept;
+    std::uint64_t GetUnderrunCount() const noexcept;
+
+protected:
+private:
+    void DeviceLoop(std::stop_token stopToken, SoftwareMixer& mixer) noexcept;
+
+    void* m_device{nullptr};
+    void* m_event{nullptr};
+    std::atomic<std::uint64_t> m_blocks{0u};
+    std::atomic<std::uint64_t> m_underruns{0u};
+    std::jthread m_thread{};
+};
@@ -0,0 +1,245 @@
+#include "Game/WaveTable.hpp"
+
+#include "Game/GameCommon.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace {
+    constexpr const std::array<char, 4> table_magic{ 'M', 'W', 'A', 'V' };
+    constexpr const std::uint32_t table_version{1u};
+
+    struct TableHeader {
+        std::array<char, 4> magic{};
+        std::uint32_t version{0u};
+        std::uint32_t waveCount{0u};
+        std::uint32_t recordSize{0u};
+    };
+
+    enum class Column : std::uint8_t {
+        ScoreMultiplier
+        , MissileCount
+        , MissileImpactSeconds
+        , FlierCooldownFrames
+        , FlierFireRateFrames
+        , ObjectColor
+        , PlayerColor
+        , GroundColor
+        , BackgroundColor
+        , Max
+    };
+
+    constexpr const std::array<std::string_view, static_cast<std::size_t>(Column::Max)> column_names{
+        "scoreMultiplier"
+        , "missileCount"
+        , "missileImpactSeconds"
+        , "flierCooldownFrames"
+        , "flierFireRateFrames"
+        , "objectColor"
+        , "playerColor"
+        , "groundColor"
+        , "backgroundColor"
+    };
+
+    std::string_view Trim(std::string_view text) noexcept {
+        constexpr const std::string_view whitespace{ " \t\r" };
+        const auto first = text.find_first_not_of(whitespace);
+        if (first == std::string_view::npos) {
+            return {};
+        }
+        return text.substr(first, text.find_last_not_of(whitespace) - first + 1u);
+    }
+
+    std::vector<std::string_view> SplitFields(std::string_view line) noexcept {
+        auto fields = std::vector<std::string_view>{};
+        for (;;) {
+            const auto comma = line.find(',');
+            fields.push_back(Trim(line.substr(0u, comma)));
+            if (comma == std::string_view::npos) {
+                return fields;
+            }
+            line.remove_prefix(comma + 1u);
+        }
+    }
+
+    template<typename T>
+    bool ParseNumber(std::string_view text, T& value, int base = 10) noexcept {
+        const auto* last = text.data() + text.size();
+        auto result = std::from_chars_result{};
+        if constexpr (std::is_floating_point_v<T>) {
+            result = std::from_chars(text.data(), last, value);
+        } else {
+            result = std::from_chars(text.data(), last, value, base);
+        }
+        return !text.empty() && result.ec == std::errc{} && result.ptr == last;
+    }
+
+    //RRGGBBAA with an optional # or 0x prefix.
+    bool ParseColor(std::string_view text, std::uint32_t& value) noexcept {
+        if (text.starts_with('#')) {
+            text.remove_prefix(1u);
+        } else if (text.starts_with("0x") || text.starts_with("0X")) {
+            text.remove_prefix(2u);
+        }
+        return text.size() == 8u && ParseNumber(text, value, 16);
+    }
+
+    //Checks every value against the limits the game code assumes.
+    std::string Validate(const WaveDefinition& wave) noexcept {
+        if (wave.scoreMultiplier < 1 || wave.scoreMultiplier > GameConstants::max_score_multiplier) {
+            return std::format("scoreMultiplier {} is outside [1, {}]", wave.scoreMultiplier, GameConstants::max_score_multiplier);
+        }
+        if (wave.missileCount < 0 || wave.missileCount > GameConstants::max_enemy_missile_count) {
+            return std::format("missileCount {} is outside [0, {}]", wave.missileCount, GameConstants::max_enemy_missile_count);
+        }
+        if (!(wave.missileImpactSeconds >= GameConstants::min_missile_impact_time)) {
+            return std::format("missileImpactSeconds {} is below {}", wave.missileImpactSeconds, GameConstants::min_missile_impact_time);
+        }
+        if (!(wave.flierCooldownFrames >= GameConstants::min_bomber_cooldown)) {
+            return std::format("flierCooldownFrames {} is below {}", wave.flierCooldownFrames, GameConstants::min_bomber_cooldown);
+        }
+        if (!(wave.flierFireRateFrames >= GameConstants::min_bomber_firerate)) {
+            return std::format("flierFireRateFrames {} is below {}", wave.flierFireRateFrames, GameConstants::min_bomber_firerate);
+        }
+        return {};
+    }
+
+    bool ParseField(Column column, std::string_view text, WaveDefinition& wave) noexcept {
+        switch (column) {
+        case Column::ScoreMultiplier: return ParseNumber(text, wave.scoreMultiplier);
+        case Column::MissileCount: return ParseNumber(text, wave.missileCount);
+        case Column::MissileImpactSeconds: return ParseNumber(text, wave.missileImpactSeconds);
+        case Column::FlierCooldownFrames: return ParseNumber(text, wave.flierCooldownFrames);
+        case Column::FlierFireRateFrames: return ParseNumber(text, wave.flierFireRateFrames);
+        case Column::ObjectColor: return ParseColor(text, wave.objectColor);
+        case Column::PlayerColor: return ParseColor(text, wave.playerColor);
+        case Column::GroundColor: return ParseColor(text, wave.groundColor);
+        case Column::BackgroundColor: return ParseColor(text, wave.backgroundColor);
+        default: return false;
+        }
+    }
+
+    //The first non-comment line names the columns, in any order; every other line is one wave.
+    bool ParseWaves(std::istream& input, std::vector<WaveDefinition>& waves, std::string& error) noexcept {
+        auto columns = std::vector<Column>{};
+        auto line = std::string{};
+        for (std::size_t line_number = 1u; std::getline(input, line); ++line_number) {
+            const auto text = Trim(line);
+            if (text.empty() || text.starts_with('#')) {
+                continue;
+            }
+            const auto fields = SplitFields(text);
+            if (columns.empty()) {
+                for (const auto field : fields) {
+                    const auto found = std::find(column_names.begin(), column_names.end(), field);
+                    if (found == column_names.end()) {
+                        error = std::format("line {}: unknown column '{}'", line_number, field);
+                        return false;
+                    }
+                    const auto column = static_cast<Column>(found - column_names.begin());
+                    if (std::find(columns.begin(), columns.end(), column) != columns.end()) {
+                        error = std::format("line {}: column '{}' appears twice", line_number, field);
+                        return false;
+                    }
+                    columns.push_back(column);
+                }
+                if (columns.size() != column_names.size()) {
+                    error = std::format("line {}: expected {} columns, found {}", line_number, column_names.size(), columns.size());
+                    return false;
+                }
+                continue;
+            }
+            if (fields.size() != columns.size()) {
+                error = std::format("line {}: expected {} values, found {}", line_number, columns.size(), fields.size());
+                return false;
+            }
+            auto wave = WaveDefinition{};
+            for (std::size_t i = 0u; i < fields.size(); ++i) {
+                if (!ParseField(columns[i], fields[i], wave)) {
+                    error = std::format("line {}: bad {} '{}'", line_number, column_names[static_cast<std::size_t>(columns[i])], fields[i]);
+                    return false;
+                }
+            }
+            if (const auto problem = Validate(wave); !problem.empty()) {
+                error = std::format("line {}: {}", line_number, problem);
+                return false;
+            }
+            waves.push_back(wave);
+        }
+        if (waves.empty()) {
+            error = "no waves defined";
+            return false;
+        }
+        return true;
+    }
+}
+
+bool WaveTable::Compile(const std::filesystem::path& sourcePath, const std::filesystem::path& tablePath, std::string& error) noexcept {
+    std::ifstream source{ sourcePath };
+    if (!source) {
+        error = std::format("cannot read {}", sourcePath.string());
+        return false;
+    }
+    auto waves = std::vector<WaveDefinition>{};
+    if (!ParseWaves(source, waves, error)) {
+        error = std::format("{} {}", sourcePath.filename().string(), error);
+        return false;
+    }
+
+    return MappedFile::Write(tablePath, [&waves](std::ostream& file) {
+        const auto header = TableHeader{ table_magic, table_version, static_cast<std::uint32_t>(waves.size()), static_cast<std::uint32_t>(sizeof(WaveDefinition)) };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(waves.data()), static_cast<std::streamsize>(sizeof(WaveDefinition) * waves.size()));
+    }, error);
+}
+
+bool WaveTable::IsStale(const std::filesystem::path& sourcePath, const std::filesystem::path& tablePath) noexcept {
+    auto ec = std::error_code{};
+    const auto table_time = std::filesystem::last_write_time(tablePath, ec);
+    if (ec) {
+        return true;
+    }
+    const auto source_time = std::filesystem::last_write_time(sourcePath, ec);
+    return !ec && source_time > table_time;
+}
+
+bool WaveTable::Open(const std::filesystem::path& tablePath) noexcept {
+    Close();
+    if (!m_file.Open(tablePath)) {
+        return false;
+    }
+    const auto bytes = m_file.GetBytes();
+    auto header = TableHeader{};
+    if (bytes.size() < sizeof(header)) {
+        Close();
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != table_magic || header.version != table_version || header.recordSize != sizeof(WaveDefinition) || header.waveCount == 0u || bytes.size() != sizeof(header) + sizeof(WaveDefinition) * header.waveCount) {
+        Close();
+        return false;
+    }
+    //The mapping is page-aligned and the header is a multiple of the record alignment, so the records are used in place.
+    m_waves = std::span<const WaveDefinition>{ reinterpret_cast<const WaveDefinition*>(bytes.data() + sizeof(header)), header.waveCount };
+    return true;
+}
+
+void WaveTable::Close() noexcept {
+    m_waves = {};
+    m_file.Close();
+}
+
+bool WaveTable::IsOpen() const noexcept {
+    return m_file.IsOpen();
+}
+
+std::span<const WaveDefinition> WaveTable::GetWaves() const noexcept {
+    return m_waves;
+}
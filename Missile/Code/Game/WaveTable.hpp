@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Game/MappedFile.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <type_traits>
+
+//One wave's tuning exactly as it is stored in the compiled table.
+struct WaveDefinition {
+    std::int32_t scoreMultiplier{1};
+    std::int32_t missileCount{0};
+    float missileImpactSeconds{0.0f};
+    float flierCooldownFrames{0.0f};
+    float flierFireRateFrames{0.0f};
+    //RGBA8, red in the highest byte.
+    std::uint32_t objectColor{0u};
+    std::uint32_t playerColor{0u};
+    std::uint32_t groundColor{0u};
+    std::uint32_t backgroundColor{0u};
+};
+static_assert(std::is_trivially_copyable_v<WaveDefinition> && sizeof(WaveDefinition) == 36u, "WaveDefinition is the on-disk record layout.");
+
+//Wave tuning compiled from a designer-edited CSV into a flat array of WaveDefinition records.
+//Open maps the compiled file and validates only its header; the records are used in place.
+class WaveTable {
+public:
+    //Used when no table is open, so a broken install still plays.
+    static constexpr const WaveDefinition fallback_wave{ 1, 12, 12.0f, 36000.0f, 36000.0f, 0xff0000ffu, 0x0000ffffu, 0xffff00ffu, 0x000000ffu };
+
+    WaveTable() = default;
+    WaveTable(const WaveTable& other) = delete;
+    WaveTable(WaveTable&& other) = delete;
+    WaveTable& operator=(const WaveTable& other) = delete;
+    WaveTable& operator=(WaveTable&& other) = delete;
+    ~WaveTable() = default;
+
+    //Parses and validates sourcePath and writes the compiled table to tablePath.
+    //On failure tablePath is untouched and error names the offending line.
+    static bool Compile(const std::filesystem::path& sourcePath, const std::filesystem::path& tablePath, std::string& error) noexcept;
+    //True if tablePath is missing or older than sourcePath.
+    static bool IsStale(const std::filesystem::path& sourcePath, const std::filesystem::path& tablePath) noexcept;
+
+    //Returns false, leaving the table empty, if the file is missing or malformed.
+    bool Open(const std::filesystem::path& tablePath) noexcept;
+    //Windows cannot replace a mapped file, so close before recompiling in place.
+    void Close() noexcept;
+    bool IsOpen() const noexcept;
+
+    std::span<const WaveDefinition> GetWaves() const noexcept;
+
+protected:
+private:
+    MappedFile m_file{};
+    std::span<const WaveDefinition> m_waves{};
+};
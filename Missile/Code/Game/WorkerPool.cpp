@@ -0,0 +1,144 @@
+#include "Game/WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace {
+    thread_local const WorkerPool* t_owningPool{nullptr};
+    thread_local std::size_t t_workerIndex{0u};
+}
+
+WorkerPool::WorkerPool() noexcept
+    : WorkerPool{ (std::max)(1u, std::thread::hardware_concurrency()) - 1u }
+{
+    /* DO NOTHING */
+}
+
+WorkerPool::WorkerPool(std::size_t workerCount) noexcept {
+    m_queues.reserve(workerCount);
+    for (std::size_t i = 0u; i < workerCount; ++i) {
+        m_queues.emplace_back(std::make_unique<WorkQueue>());
+    }
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0u; i < workerCount; ++i) {
+        m_workers.emplace_back([this, i](std::stop_token stopToken) { this->WorkerLoop(stopToken, i); });
+    }
+}
+
+WorkerPool::~WorkerPool() noexcept {
+    for (auto& worker : m_workers) {
+        worker.request_stop();
+    }
+    {
+        std::scoped_lock lock(m_sleepMutex);
+    }
+    m_signal.notify_all();
+    m_workers.clear();
+}
+
+std::size_t WorkerPool::GetWorkerCount() const noexcept {
+    return m_workers.size();
+}
+
+void WorkerPool::Submit(std::function<void()> job) noexcept {
+    if (m_queues.empty()) {
+        job();
+        return;
+    }
+    const auto index = t_owningPool == this ? t_workerIndex : m_nextQueue.fetch_add(1u, std::memory_order_relaxed) % m_queues.size();
+    {
+        auto& queue = *m_queues[index];
+        std::scoped_lock lock(queue.mutex);
+        queue.jobs.emplace_back(std::move(job));
+    }
+    m_queuedJobs.fetch_add(1u, std::memory_order_release);
+    {
+        std::scoped_lock lock(m_sleepMutex);
+    }
+    m_signal.notify_one();
+}
+
+void WorkerPool::ParallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& work) noexcept {
+    if (count == 0u) {
+        return;
+    }
+    grainSize = (std::max)(std::size_t{ 1u }, grainSize);
+    const auto range_count = (count + grainSize - 1u) / grainSize;
+    if (range_count == 1u || m_workers.empty()) {
+        work(0u, count);
+        return;
+    }
+    std::latch remaining{ static_cast<std::ptrdiff_t>(range_count) };
+    for (std::size_t begin = 0u; begin < count; begin += grainSize) {
+        const auto end = (std::min)(count, begin + grainSize);
+        Submit([&work, &remaining, begin, end]() {
+            work(begin, end);
+            remaining.count_down();
+        });
+    }
+    HelpUntil(remaining);
+}
+
+void WorkerPool::HelpUntil(std::latch& latch) noexcept {
+    while (!latch.try_wait()) {
+        if (!RunOneJob()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WorkerPool::WorkerLoop(std::stop_token stopToken, std::size_t index) noexcept {
+    t_owningPool = this;
+    t_workerIndex = index;
+    while (!stopToken.stop_requested()) {
+        std::function<void()> job{};
+        if (TryPopOwn(index, job) || TrySteal(index, job)) {
+            job();
+            continue;
+        }
+        std::unique_lock lock(m_sleepMutex);
+        if (!m_signal.wait(lock, stopToken, [this]() { return m_queuedJobs.load(std::memory_order_acquire) != 0u; })) {
+            return;
+        }
+    }
+}
+
+bool WorkerPool::TryPopOwn(std::size_t index, std::function<void()>& job) noexcept {
+    auto& queue = *m_queues[index];
+    std::scoped_lock lock(queue.mutex);
+    if (queue.jobs.empty()) {
+        return false;
+    }
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    m_queuedJobs.fetch_sub(1u, std::memory_order_acq_rel);
+    return true;
+}
+
+bool WorkerPool::TrySteal(std::size_t thiefIndex, std::function<void()>& job) noexcept {
+    const auto queue_count = m_queues.size();
+    for (std::size_t offset = 1u; offset <= queue_count; ++offset) {
+        auto& queue = *m_queues[(thiefIndex + offset) % queue_count];
+        std::scoped_lock lock(queue.mutex);
+        if (queue.jobs.empty()) {
+            continue;
+        }
+        job = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        m_queuedJobs.fetch_sub(1u, std::memory_order_acq_rel);
+        return true;
+    }
+    return false;
+}
+
+bool WorkerPool::RunOneJob() noexcept {
+    if (m_queues.empty()) {
+        return false;
+    }
+    std::function<void()> job{};
+    const auto index = t_owningPool == this ? t_workerIndex : m_nextQueue.load(std::memory_order_relaxed) % m_queues.size();
+    if ((t_owningPool == this && TryPopOwn(index, job)) || TrySteal(index, job)) {
+        job();
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+class WorkerPool {
+public:
+    WorkerPool() noexcept;
+    explicit WorkerPool(std::size_t workerCount) noexcept;
+    WorkerPool(const WorkerPool& other) = delete;
+    WorkerPool(WorkerPool&& other) = delete;
+    WorkerPool& operator=(const WorkerPool& other) = delete;
+    WorkerPool& operator=(WorkerPool&& other) = delete;
+    ~WorkerPool() noexcept;
+
+    //Number of background threads. The thread calling ParallelFor or HelpUntil also does work.
+    std::size_t GetWorkerCount() const noexcept;
+
+    //Jobs submitted from a worker go to the back of that worker's own queue; idle workers steal from the front of the others.
+    void Submit(std::function<void()> job) noexcept;
+
+    //Splits [0, count) into ranges of at most grainSize and blocks until every range has been processed.
+    void ParallelFor(std::size_t count, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& work) noexcept;
+
+    //Runs queued jobs on the calling thread until the latch is released.
+    void HelpUntil(std::latch& latch) noexcept;
+
+protected:
+private:
+    struct WorkQueue {
+        std::mutex mutex{};
+        std::deque<std::function<void()>> jobs{};
+    };
+
+    void WorkerLoop(std::stop_token stopToken, std::size_t index) noexcept;
+    bool TryPopOwn(std::size_t index, std::function<void()>& job) noexcept;
+    bool TrySteal(std::size_t thiefIndex, std::function<void()>& job) noexcept;
+    bool RunOneJob() noexcept;
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues{};
+    std::vector<std::jthread> m_workers{};
+    std::atomic<std::size_t> m_queuedJobs{0u};
+    std::atomic<std::size_t> m_nextQueue{0u};
+    std::mutex m_sleepMutex{};
+    std::condition_variable_any m_signal{};
+};